@@ -0,0 +1,117 @@
+/**
+ * @file benchmarks/benchmark_retry_scheduler.cpp
+ * @brief Contention benchmark for the RetryScheduler with exclusive and shared mutexes.
+ *
+ * Every thread performs a read-heavy mix of const and non-const execute calls for a fixed
+ * amount of time. The total throughput is reported for each mutex type and thread count.
+ */
+// system includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// local includes
+#include "display_device/retry_scheduler.h"
+
+namespace {
+  using namespace std::chrono_literals;
+
+  constexpr auto RUN_DURATION {500ms};
+  constexpr int WRITES_PER_READS {100};  ///< One non-const call per this many const calls.
+
+  volatile std::uint64_t query_sink {0};  ///< Receives the query results, so that the queries cannot be optimized away.
+
+  /**
+   * @brief Emulates an interface with a query that takes a couple of microseconds.
+   */
+  class BenchmarkIface {
+  public:
+    [[nodiscard]] std::uint64_t query() const {
+      std::uint64_t value {m_state.load(std::memory_order_relaxed)};
+      for (int i {0}; i < 2000; ++i) {
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+      }
+      return value;
+    }
+
+    void update() {
+      m_state.fetch_add(1, std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic_uint64_t m_state {1};
+  };
+
+  template<class MutexT>
+  double measureThroughput(const int thread_count) {
+    display_device::RetryScheduler<BenchmarkIface, MutexT> scheduler {std::make_unique<BenchmarkIface>()};
+
+    std::atomic_bool running {true};
+    std::atomic_uint64_t total_calls {0};
+    std::atomic_uint64_t sink {0};
+
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+    for (int i {0}; i < thread_count; ++i) {
+      threads.emplace_back([&]() {
+        std::uint64_t calls {0};
+        std::uint64_t local_sink {0};
+        while (running.load(std::memory_order_relaxed)) {
+          if (calls % WRITES_PER_READS == WRITES_PER_READS - 1) {
+            scheduler.execute([](BenchmarkIface &iface) {
+              iface.update();
+            });
+          } else {
+            local_sink += std::as_const(scheduler).execute([](const BenchmarkIface &iface) {
+              return iface.query();
+            });
+          }
+          calls++;
+        }
+
+        total_calls += calls;
+        sink += local_sink;
+      });
+    }
+
+    std::this_thread::sleep_for(RUN_DURATION);
+    running = false;
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    query_sink = sink.load();
+
+    return static_cast<double>(total_calls) / std::chrono::duration<double>(RUN_DURATION).count();
+  }
+}  // namespace
+
+int main() {
+  const auto max_threads {static_cast<int>(std::max(2U, std::thread::hardware_concurrency()))};
+
+  std::cout << std::setw(8) << "threads"
+            << std::setw(18) << "std::mutex"
+            << std::setw(22) << "std::shared_mutex"
+            << std::setw(10) << "gain" << "\n";
+
+  for (int thread_count {1}; thread_count <= max_threads; thread_count *= 2) {
+    const auto exclusive {measureThroughput<std::mutex>(thread_count)};
+    const auto shared {measureThroughput<std::shared_mutex>(thread_count)};
+
+    std::cout << std::setw(8) << thread_count
+              << std::setw(14) << std::fixed << std::setprecision(0) << exclusive << " op/s"
+              << std::setw(18) << shared << " op/s"
+              << std::setw(9) << std::setprecision(2) << shared / exclusive << "x\n";
+  }
+
+  return 0;
+}
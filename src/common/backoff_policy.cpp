@@ -0,0 +1,111 @@
+/**
+ * @file src/common/backoff_policy.cpp
+ * @brief Definitions for the backoff policies used by the RetryScheduler.
+ */
+// class header include
+#include "display_device/backoff_policy.h"
+
+// system includes
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <random>
+#include <thread>
+
+namespace display_device {
+  namespace {
+    static_assert(BackoffPolicy<ConstantBackoff>);
+    static_assert(BackoffPolicy<LinearBackoff>);
+    static_assert(BackoffPolicy<ExponentialBackoff>);
+    static_assert(BackoffPolicy<DecorrelatedJitterBackoff>);
+    static_assert(BackoffPolicy<AnyBackoffPolicy>);
+
+    /**
+     * @brief Convert the floating point delay to milliseconds, clamping it to the [1ms, max_delay] range.
+     */
+    std::chrono::milliseconds clampDelay(const double delay_ms, const std::chrono::milliseconds max_delay) {
+      const auto max_delay_ms {static_cast<double>(max_delay.count())};
+      return std::chrono::milliseconds {static_cast<std::chrono::milliseconds::rep>(std::clamp(std::round(delay_ms), 1.0, max_delay_ms))};
+    }
+
+    /**
+     * @brief Get the random engine for the jitter, seeded on the first use in the current thread.
+     * @note `std::random_device` may be slow or throw on some platforms, hence it is queried only once per thread
+     *       and the clock together with the thread id is used as a fallback seed.
+     */
+    std::minstd_rand &getRandomEngine() {
+      thread_local std::minstd_rand engine {[]() -> std::minstd_rand::result_type {
+        try {
+          return std::random_device {}();
+        } catch (const std::exception &) {  // NOSONAR(cpp:S1181): Any entropy source failure falls back to the clock seed.
+          const auto time_seed {static_cast<std::size_t>(std::chrono::steady_clock::now().time_since_epoch().count())};
+          return static_cast<std::minstd_rand::result_type>(time_seed ^ std::hash<std::thread::id> {}(std::this_thread::get_id()));
+        }
+      }()};
+      return engine;
+    }
+
+    /**
+     * @brief Update the state and return the delay.
+     */
+    std::chrono::milliseconds takeDelay(BackoffState &state, const std::chrono::milliseconds delay) {
+      state.m_attempt++;
+      state.m_previous_delay = delay;
+      return delay;
+    }
+  }  // namespace
+
+  std::chrono::milliseconds ConstantBackoff::nextDelay(BackoffState &state) const {
+    return takeDelay(state, m_delay);
+  }
+
+  bool ConstantBackoff::isValid() const {
+    return m_delay > std::chrono::milliseconds::zero();
+  }
+
+  std::chrono::milliseconds LinearBackoff::nextDelay(BackoffState &state) const {
+    const auto delay {static_cast<double>(m_initial_delay.count()) + static_cast<double>(m_increment.count()) * static_cast<double>(state.m_attempt)};
+    return takeDelay(state, clampDelay(delay, m_max_delay));
+  }
+
+  bool LinearBackoff::isValid() const {
+    return m_initial_delay > std::chrono::milliseconds::zero() &&
+           m_increment >= std::chrono::milliseconds::zero() &&
+           m_max_delay >= m_initial_delay;
+  }
+
+  std::chrono::milliseconds ExponentialBackoff::nextDelay(BackoffState &state) const {
+    // Double arithmetic saturates to infinity instead of overflowing and is clamped afterward.
+    const auto max_delay {static_cast<double>(m_max_delay.count())};
+    auto delay {std::min(static_cast<double>(m_initial_delay.count()) * std::pow(m_multiplier, static_cast<double>(state.m_attempt)), max_delay)};
+    if (m_jitter > 0.0) {
+      // The range is cut at the maximum instead of clamping the result, so that the capped delays do not pile up at the maximum.
+      std::uniform_real_distribution<double> distribution {1.0 - m_jitter, std::min(1.0 + m_jitter, max_delay / delay)};
+      delay *= distribution(getRandomEngine());
+    }
+
+    return takeDelay(state, clampDelay(delay, m_max_delay));
+  }
+
+  bool ExponentialBackoff::isValid() const {
+    return m_initial_delay > std::chrono::milliseconds::zero() &&
+           m_max_delay >= m_initial_delay &&
+           m_multiplier >= 1.0 &&
+           m_jitter >= 0.0 && m_jitter < 1.0;
+  }
+
+  std::chrono::milliseconds DecorrelatedJitterBackoff::nextDelay(BackoffState &state) const {
+    const auto previous_delay {state.m_attempt == 0 ? m_base_delay : state.m_previous_delay};
+    const auto lower_bound {static_cast<double>(m_base_delay.count())};
+    const auto upper_bound {std::max(lower_bound, static_cast<double>(previous_delay.count()) * 3.0)};
+
+    std::uniform_real_distribution<double> distribution {lower_bound, upper_bound};
+    return takeDelay(state, clampDelay(distribution(getRandomEngine()), m_max_delay));
+  }
+
+  bool DecorrelatedJitterBackoff::isValid() const {
+    return m_base_delay > std::chrono::milliseconds::zero() &&
+           m_max_delay >= m_base_delay;
+  }
+}  // namespace display_device
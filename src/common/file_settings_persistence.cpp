@@ -7,84 +7,395 @@
 
 // system includes
 #include <algorithm>
+#include <atomic>
 #include <fstream>
-#include <iterator>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <system_error>
+
+#ifdef _WIN32
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <cerrno>
+  #include <fcntl.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
 
 // local includes
 #include "display_device/logging.h"
 
 namespace display_device {
-  FileSettingsPersistence::FileSettingsPersistence(std::filesystem::path filepath):
-      m_filepath {std::move(filepath)} {
-    if (m_filepath.empty()) {
-      throw std::invalid_argument {"Empty filename provided for FileSettingsPersistence!"};
+  namespace {
+    std::error_code getLastError() {
+#ifdef _WIN32
+      return {static_cast<int>(GetLastError()), std::system_category()};
+#else
+      return {errno, std::generic_category()};
+#endif
     }
-  }
 
-  bool FileSettingsPersistence::store(const std::vector<std::uint8_t> &data) {
-    try {
-      std::ofstream stream {m_filepath, std::ios::binary | std::ios::trunc};
-      if (!stream) {
-        DD_LOG(error) << "Failed to open " << m_filepath << " for writing!";
-        return false;
+    /**
+     * @brief Get a temporary filepath next to the target that is unique across the processes and the instances.
+     */
+    std::filesystem::path makeTempFilepath(const std::filesystem::path &filepath) {
+      static std::atomic_uint64_t counter {0};
+#ifdef _WIN32
+      const auto process_id {GetCurrentProcessId()};
+#else
+      const auto process_id {::getpid()};
+#endif
+
+      auto temp_filepath {filepath};
+      temp_filepath += "." + std::to_string(process_id) + "." + std::to_string(counter++) + ".tmp";
+      return temp_filepath;
+    }
+
+    /**
+     * @brief Write the data to the new file and flush it to the disk.
+     * @param permissions Permissions to be set for the new file (if any). Ignored on Windows,
+     *                    where the file gets the default security descriptor of the directory.
+     */
+    std::error_code writeAndSync(const std::filesystem::path &filepath, std::span<const std::uint8_t> data, const std::optional<std::filesystem::perms> &permissions) {
+#ifdef _WIN32
+      (void) permissions;
+      const HANDLE file {CreateFileW(filepath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr)};
+      if (file == INVALID_HANDLE_VALUE) {
+        return getLastError();
       }
 
-      std::ranges::copy(data, std::ostreambuf_iterator<char> {stream});
-      return true;
-    } catch (const std::ios_base::failure &error) {
-      DD_LOG(error) << "Failed to write to " << m_filepath << "! Error:\n"
-                    << error.what();
-      return false;
+      std::error_code error_code;
+      while (!data.empty()) {
+        DWORD written {0};
+        const auto chunk_size {static_cast<DWORD>(std::min<std::size_t>(data.size(), MAXDWORD))};
+        if (!WriteFile(file, data.data(), chunk_size, &written, nullptr)) {
+          error_code = getLastError();
+          break;
+        }
+        data = data.subspan(written);
+      }
+
+      if (!error_code && !FlushFileBuffers(file)) {
+        error_code = getLastError();
+      }
+      CloseHandle(file);
+      return error_code;
+#else
+      const int file {::open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666)};
+      if (file < 0) {
+        return getLastError();
+      }
+
+      std::error_code error_code;
+      // Explicit fchmod, since the mode given to open is still subject to umask
+      if (permissions && ::fchmod(file, static_cast<mode_t>(*permissions & std::filesystem::perms::mask)) != 0) {
+        error_code = getLastError();
+      }
+
+      while (!error_code && !data.empty()) {
+        const auto written {::write(file, data.data(), data.size())};
+        if (written < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          error_code = getLastError();
+          break;
+        }
+        data = data.subspan(static_cast<std::size_t>(written));
+      }
+
+  #ifdef __APPLE__
+      // fsync only hands the data over to the drive on macOS, F_FULLFSYNC also flushes the drive cache
+      if (!error_code && ::fcntl(file, F_FULLFSYNC) != 0 && ::fsync(file) != 0) {
+  #else
+      if (!error_code && ::fdatasync(file) != 0) {
+  #endif
+        error_code = getLastError();
+      }
+
+      if (::close(file) != 0 && !error_code) {
+        error_code = getLastError();
+      }
+      return error_code;
+#endif
     }
-  }
 
-  std::optional<std::vector<std::uint8_t>> FileSettingsPersistence::load() const {
-    std::error_code error_code;
-    if (!std::filesystem::exists(m_filepath, error_code)) {
+    /**
+     * @brief Atomically replace the target file with the temporary one.
+     */
+    std::error_code replaceFile(const std::filesystem::path &temp_filepath, const std::filesystem::path &filepath) {
+#ifdef _WIN32
+      if (!MoveFileExW(temp_filepath.c_str(), filepath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        return getLastError();
+      }
+      return {};
+#else
+      std::error_code error_code;
+      std::filesystem::rename(temp_filepath, filepath, error_code);
       if (error_code) {
-        DD_LOG(error) << "Failed to load " << m_filepath << "! Error:\n"
-                      << "[" << error_code.value() << "] " << error_code.message();
-        return std::nullopt;
+        return error_code;
       }
 
-      return std::vector<std::uint8_t> {};
+      // The rename itself is only durable once the directory entry is flushed too (best effort).
+      const auto directory {filepath.parent_path().empty() ? std::filesystem::path {"."} : filepath.parent_path()};
+      if (const int directory_file {::open(directory.c_str(), O_RDONLY | O_CLOEXEC)}; directory_file >= 0) {
+        ::fsync(directory_file);
+        ::close(directory_file);
+      }
+      return {};
+#endif
     }
 
-    if (!std::filesystem::is_regular_file(m_filepath, error_code)) {
-      if (error_code) {
-        DD_LOG(error) << "Failed to inspect " << m_filepath << "! Error:\n"
-                      << "[" << error_code.value() << "] " << error_code.message();
-      } else {
-        DD_LOG(error) << "Failed to load " << m_filepath << "! Path is not a regular file.";
+    bool storeDurably(const std::filesystem::path &filepath, const std::vector<std::uint8_t> &data) {
+      const auto temp_filepath {makeTempFilepath(filepath)};
+
+      // The replaced file keeps its permissions, the new one is created with the default ones.
+      std::optional<std::filesystem::perms> permissions;
+      std::error_code status_error;
+      if (const auto status {std::filesystem::status(filepath, status_error)}; std::filesystem::is_regular_file(status)) {
+        permissions = status.permissions();
       }
 
-      return std::nullopt;
+      if (const auto error_code {writeAndSync(temp_filepath, data, permissions)}) {
+        DD_LOG_CAT(persistence, error) << "Failed to write to " << temp_filepath << "! Error:\n"
+                                       << "[" << error_code.value() << "] " << error_code.message();
+        std::error_code ignored;
+        std::filesystem::remove(temp_filepath, ignored);
+        return false;
+      }
+
+      if (const auto error_code {replaceFile(temp_filepath, filepath)}) {
+        DD_LOG_CAT(persistence, error) << "Failed to replace " << filepath << " with " << temp_filepath << "! Error:\n"
+                                       << "[" << error_code.value() << "] " << error_code.message();
+        std::error_code ignored;
+        std::filesystem::remove(temp_filepath, ignored);
+        return false;
+      }
+
+      return true;
     }
 
-    try {
-      std::ifstream stream {m_filepath, std::ios::binary};
-      if (!stream) {
-        DD_LOG(error) << "Failed to open " << m_filepath << " for reading!";
-        return std::nullopt;
+    bool storeDirectly(const std::filesystem::path &filepath, const std::vector<std::uint8_t> &data) {
+      try {
+        std::ofstream stream {filepath, std::ios::binary | std::ios::trunc};
+        if (!stream) {
+          DD_LOG_CAT(persistence, error) << "Failed to open " << filepath << " for writing!";
+          return false;
+        }
+
+        stream.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!stream.flush()) {
+          DD_LOG_CAT(persistence, error) << "Failed to write to " << filepath << "!";
+          return false;
+        }
+        return true;
+      } catch (const std::ios_base::failure &error) {
+        DD_LOG_CAT(persistence, error) << "Failed to write to " << filepath << "! Error:\n"
+                                       << error.what();
+        return false;
+      }
+    }
+
+    /**
+     * @brief Read-only handle of the file to be loaded that is closed once it goes out of scope.
+     *
+     * The file is opened and inspected with a single open/fstat pair.
+     */
+    class ReadOnlyFile final {
+    public:
+      /**
+       * @brief Result of opening the file.
+       */
+      enum class Status {
+        Opened,  ///< The file is opened and its size is known.
+        NotFound,  ///< The file does not exist.
+        NotRegularFile,  ///< The path exists, but is not a regular file.
+        Failed  ///< The file could not be opened or inspected.
+      };
+
+      explicit ReadOnlyFile(const std::filesystem::path &filepath) {
+#ifdef _WIN32
+        // Backup semantics allow opening the directories, so that they can be reported as such.
+        m_file = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE) {
+          m_error = getLastError();
+          const auto error {static_cast<DWORD>(m_error.value())};
+          m_status = error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND ? Status::NotFound : Status::Failed;
+          return;
+        }
+
+        BY_HANDLE_FILE_INFORMATION info {};
+        if (!GetFileInformationByHandle(m_file, &info)) {
+          m_error = getLastError();
+          m_status = Status::Failed;
+          return;
+        }
+
+        if ((info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0 || GetFileType(m_file) != FILE_TYPE_DISK) {
+          m_status = Status::NotRegularFile;
+          return;
+        }
+        m_size = static_cast<std::size_t>((static_cast<std::uint64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow);
+#else
+        // Non-blocking, so that opening a FIFO does not hang (it is rejected below anyway).
+        m_file = ::open(filepath.c_str(), O_RDONLY | O_CLOEXEC | O_NONBLOCK);
+        if (m_file < 0) {
+          m_error = getLastError();
+          m_status = m_error.value() == ENOENT || m_error.value() == ENOTDIR ? Status::NotFound : Status::Failed;
+          return;
+        }
+
+        struct stat info {};
+        if (::fstat(m_file, &info) != 0) {
+          m_error = getLastError();
+          m_status = Status::Failed;
+          return;
+        }
+
+        if (!S_ISREG(info.st_mode)) {
+          m_status = Status::NotRegularFile;
+          return;
+        }
+        m_size = static_cast<std::size_t>(info.st_size);
+#endif
+        m_status = Status::Opened;
+      }
+
+      ReadOnlyFile(const ReadOnlyFile &) = delete;
+      ReadOnlyFile &operator=(const ReadOnlyFile &) = delete;
+
+      ~ReadOnlyFile() {
+#ifdef _WIN32
+        if (m_file != INVALID_HANDLE_VALUE) {
+          CloseHandle(m_file);
+        }
+#else
+        if (m_file >= 0) {
+          ::close(m_file);
+        }
+#endif
+      }
+
+      [[nodiscard]] Status getStatus() const {
+        return m_status;
+      }
+
+      [[nodiscard]] const std::error_code &getError() const {
+        return m_error;
+      }
+
+      /**
+       * @brief Read the whole file into the buffer sized upfront.
+       */
+      std::error_code read(std::vector<std::uint8_t> &data) const {
+        data.resize(m_size);
+        std::size_t total {0};
+        while (total < data.size()) {
+#ifdef _WIN32
+          DWORD result {0};
+          const auto chunk_size {static_cast<DWORD>(std::min<std::size_t>(data.size() - total, MAXDWORD))};
+          if (!ReadFile(m_file, data.data() + total, chunk_size, &result, nullptr)) {
+            return getLastError();
+          }
+#else
+          const auto result {::read(m_file, data.data() + total, data.size() - total)};
+          if (result < 0) {
+            if (errno == EINTR) {
+              continue;
+            }
+            return getLastError();
+          }
+#endif
+          if (result == 0) {
+            // The file was truncated in the meantime
+            break;
+          }
+          total += static_cast<std::size_t>(result);
+        }
+
+        data.resize(total);
+        return {};
       }
 
-      return std::vector<std::uint8_t> {std::istreambuf_iterator<char> {stream}, std::istreambuf_iterator<char> {}};
-    } catch (const std::ios_base::failure &error) {
-      DD_LOG(error) << "Failed to read " << m_filepath << "! Error:\n"
-                    << error.what();
+    private:
+#ifdef _WIN32
+      HANDLE m_file {INVALID_HANDLE_VALUE};  ///< File handle.
+#else
+      int m_file {-1};  ///< File descriptor.
+#endif
+      Status m_status {Status::Failed};  ///< Result of opening the file.
+      std::error_code m_error {};  ///< Error of opening the file (if any).
+      std::size_t m_size {0};  ///< Size of the file at the time of opening.
+    };
+
+    /**
+     * @brief Log the reason why the file could not be opened (if any).
+     * @returns True if the file is opened or does not exist, false otherwise.
+     */
+    bool checkOpenStatus(const ReadOnlyFile &file, const std::filesystem::path &filepath) {
+      switch (file.getStatus()) {  // GCOVR_EXCL_BR_LINE for when there is no case match...
+        using enum ReadOnlyFile::Status;
+
+        case Opened:
+        case NotFound:
+          return true;
+        case NotRegularFile:
+          DD_LOG_CAT(persistence, error) << "Failed to load " << filepath << "! Path is not a regular file.";
+          return false;
+        case Failed:
+          DD_LOG_CAT(persistence, error) << "Failed to load " << filepath << "! Error:\n"
+                                         << "[" << file.getError().value() << "] " << file.getError().message();
+          return false;
+      }
+      return false;  // GCOVR_EXCL_LINE
+    }
+  }  // namespace
+
+  FileSettingsPersistence::FileSettingsPersistence(std::filesystem::path filepath, const StoreMode store_mode):
+      m_filepath {std::move(filepath)},
+      m_store_mode {store_mode} {
+    if (m_filepath.empty()) {
+      throw std::invalid_argument {"Empty filename provided for FileSettingsPersistence!"};
+    }
+  }
+
+  bool FileSettingsPersistence::store(const std::vector<std::uint8_t> &data) {
+    std::lock_guard lock {m_mutex};
+    return m_store_mode == StoreMode::Durable ? storeDurably(m_filepath, data) : storeDirectly(m_filepath, data);
+  }
+
+  std::optional<std::vector<std::uint8_t>> FileSettingsPersistence::load() const {
+    const ReadOnlyFile file {m_filepath};
+    if (!checkOpenStatus(file, m_filepath)) {
       return std::nullopt;
     }
+
+    std::vector<std::uint8_t> data;
+    if (file.getStatus() == ReadOnlyFile::Status::Opened) {
+      if (const auto error_code {file.read(data)}) {
+        DD_LOG_CAT(persistence, error) << "Failed to read " << m_filepath << "! Error:\n"
+                                       << "[" << error_code.value() << "] " << error_code.message();
+        return std::nullopt;
+      }
+    }
+
+    return data;
   }
 
   bool FileSettingsPersistence::clear() {
+    std::lock_guard lock {m_mutex};
+
     // Return valud does not matter since we check the error code in case the file could NOT be removed.
     std::error_code error_code;
     std::filesystem::remove(m_filepath, error_code);
 
     if (error_code) {
-      DD_LOG(error) << "Failed to remove " << m_filepath << "! Error:\n"
-                    << "[" << error_code.value() << "] " << error_code.message();
+      DD_LOG_CAT(persistence, error) << "Failed to remove " << m_filepath << "! Error:\n"
+                                     << "[" << error_code.value() << "] " << error_code.message();
       return false;
     }
 
@@ -0,0 +1,194 @@
+/**
+ * @file src/common/include/display_device/backoff_policy.h
+ * @brief Declarations for the backoff policies used by the RetryScheduler.
+ */
+#pragma once
+
+// system includes
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace display_device {
+  /**
+   * @brief Mutable state of a backoff sequence.
+   *
+   * One state is kept per scheduled job, so that the policies themselves can stay immutable.
+   * @note The jittering policies draw from a random engine that is seeded once per thread,
+   *       so creating the state is cheap and does not touch the system entropy source.
+   */
+  struct BackoffState {
+    std::size_t m_attempt {0};  ///< Number of delays that have been taken so far.
+    std::chrono::milliseconds m_previous_delay {0};  ///< Last delay that was taken (0 if none).
+  };
+
+  /**
+   * @brief Same delay for every retry.
+   */
+  struct ConstantBackoff {
+    std::chrono::milliseconds m_delay;  ///< Delay between the retries.
+
+    /**
+     * @brief Compute the next delay.
+     * @param state State of the sequence to be updated.
+     * @returns The next delay.
+     */
+    [[nodiscard]] std::chrono::milliseconds nextDelay(BackoffState &state) const;
+
+    /**
+     * @brief Check if the policy parameters are valid.
+     * @returns True if valid, false otherwise.
+     */
+    [[nodiscard]] bool isValid() const;
+  };
+
+  /**
+   * @brief Delay grows by the same increment on every retry, up to the maximum.
+   */
+  struct LinearBackoff {
+    std::chrono::milliseconds m_initial_delay;  ///< Delay before the first retry.
+    std::chrono::milliseconds m_increment;  ///< Value to add on every retry.
+    std::chrono::milliseconds m_max_delay;  ///< Upper limit for the delay.
+
+    /**
+     * @copydoc ConstantBackoff::nextDelay
+     */
+    [[nodiscard]] std::chrono::milliseconds nextDelay(BackoffState &state) const;
+
+    /**
+     * @copydoc ConstantBackoff::isValid
+     */
+    [[nodiscard]] bool isValid() const;
+  };
+
+  /**
+   * @brief Delay is multiplied on every retry, up to the maximum, with an optional symmetric jitter.
+   * @note The maximum is a hard limit, so the jitter range is cut off where it would exceed it.
+   *       Once the cap is reached the delays are spread uniformly in the [max * (1 - jitter), max] range.
+   * @examples
+   * // Exponential up to 5s with ±20% jitter
+   * const ExponentialBackoff policy { .m_initial_delay = 100ms, .m_max_delay = 5s, .m_jitter = 0.2 };
+   * @examples_end
+   */
+  struct ExponentialBackoff {
+    std::chrono::milliseconds m_initial_delay;  ///< Delay before the first retry.
+    std::chrono::milliseconds m_max_delay;  ///< Upper limit for the delay.
+    double m_multiplier {2.0};  ///< Factor to multiply the delay by on every retry.
+    double m_jitter {0.0};  ///< Fraction in range [0, 1) by which the delay is randomly shifted in both directions.
+
+    /**
+     * @copydoc ConstantBackoff::nextDelay
+     */
+    [[nodiscard]] std::chrono::milliseconds nextDelay(BackoffState &state) const;
+
+    /**
+     * @copydoc ConstantBackoff::isValid
+     */
+    [[nodiscard]] bool isValid() const;
+  };
+
+  /**
+   * @brief "Decorrelated jitter" policy - the next delay is picked randomly between the base
+   *        delay and 3 times the previous delay, up to the maximum.
+   * @note Spreads the retries of many hosts that started failing at the same moment.
+   */
+  struct DecorrelatedJitterBackoff {
+    std::chrono::milliseconds m_base_delay;  ///< Lower limit for the delay.
+    std::chrono::milliseconds m_max_delay;  ///< Upper limit for the delay.
+
+    /**
+     * @copydoc ConstantBackoff::nextDelay
+     */
+    [[nodiscard]] std::chrono::milliseconds nextDelay(BackoffState &state) const;
+
+    /**
+     * @copydoc ConstantBackoff::isValid
+     */
+    [[nodiscard]] bool isValid() const;
+  };
+
+  /**
+   * @brief Requirements for the backoff policy.
+   *
+   * The policy must compute the next delay in constant time without allocations.
+   */
+  template<class PolicyT>
+  concept BackoffPolicy = requires(const PolicyT &policy, BackoffState &state) {
+    { policy.nextDelay(state) } -> std::same_as<std::chrono::milliseconds>;
+    { policy.isValid() } -> std::same_as<bool>;
+  };
+
+  /**
+   * @brief Type-erased holder for any policy satisfying the BackoffPolicy concept.
+   *
+   * The held policy is immutable and shared between the copies, so copying the holder is cheap
+   * and computing the delay does not allocate.
+   * @examples
+   * struct FibonacciBackoff {
+   *   std::chrono::milliseconds nextDelay(BackoffState &state) const;
+   *   bool isValid() const;
+   * };
+   *
+   * const AnyBackoffPolicy policy {FibonacciBackoff {}};
+   * @examples_end
+   */
+  class AnyBackoffPolicy {
+  public:
+    /**
+     * @brief Wrap the policy.
+     * @param policy Policy to be wrapped.
+     */
+    template<class PolicyT>
+      requires(!std::same_as<std::remove_cvref_t<PolicyT>, AnyBackoffPolicy> && BackoffPolicy<std::remove_cvref_t<PolicyT>>)
+    AnyBackoffPolicy(PolicyT &&policy):  // NOLINT(*-explicit-constructor) implicit for the designated initializers
+        m_policy {std::make_shared<const Model<std::remove_cvref_t<PolicyT>>>(std::forward<PolicyT>(policy))} {}
+
+    /**
+     * @copydoc ConstantBackoff::nextDelay
+     */
+    [[nodiscard]] std::chrono::milliseconds nextDelay(BackoffState &state) const {
+      return m_policy->nextDelay(state);
+    }
+
+    /**
+     * @copydoc ConstantBackoff::isValid
+     */
+    [[nodiscard]] bool isValid() const {
+      return m_policy->isValid();
+    }
+
+  private:
+    /**
+     * @brief Interface of the wrapped policy.
+     */
+    struct Concept {
+      virtual ~Concept() = default;
+      [[nodiscard]] virtual std::chrono::milliseconds nextDelay(BackoffState &state) const = 0;
+      [[nodiscard]] virtual bool isValid() const = 0;
+    };
+
+    /**
+     * @brief Implementation forwarding to the wrapped policy.
+     */
+    template<class PolicyT>
+    struct Model final: Concept {
+      explicit Model(PolicyT policy):
+          m_policy {std::move(policy)} {}
+
+      [[nodiscard]] std::chrono::milliseconds nextDelay(BackoffState &state) const override {
+        return m_policy.nextDelay(state);
+      }
+
+      [[nodiscard]] bool isValid() const override {
+        return m_policy.isValid();
+      }
+
+      PolicyT m_policy;
+    };
+
+    std::shared_ptr<const Concept> m_policy;
+  };
+}  // namespace display_device
@@ -7,7 +7,14 @@
 #ifdef DD_JSON_DETAIL
   // system includes
   #include <nlohmann/json.hpp>
+  #include <ostream>
+  #include <span>
   #include <stdexcept>
+  #include <string_view>
+  #include <vector>
+
+  // local includes
+  #include "json_serializer_details.h"
 
 namespace display_device {
   // A shared "toJson" implementation. Extracted here for UTs + coverage.
@@ -41,9 +48,30 @@ namespace display_device {
     }
   }
 
+  // A shared "jsonView" implementation. Extracted here for UTs + coverage.
+  template<typename Type>
+  void writeJsonHelper(std::ostream &stream, const Type &obj, const std::optional<unsigned int> &indent) {
+    try {
+      if constexpr (JsonWritable<Type>) {
+        JsonWriter writer {stream, indent};
+        writeJson(writer, obj);
+      } else {
+        // Types with custom "to_json" serializers still need the intermediate object
+        const nlohmann::json json_obj = obj;
+        stream << json_obj.dump(static_cast<int>(indent.value_or(-1)));
+      }
+    } catch (const nlohmann::json::exception &err) {  // GCOVR_EXCL_BR_LINE for fallthrough branch
+      stream << err.what();
+    } catch (const std::out_of_range &err) {  // GCOVR_EXCL_BR_LINE for fallthrough branch
+      stream << err.what();
+    } catch (const std::invalid_argument &err) {  // GCOVR_EXCL_BR_LINE for fallthrough branch
+      stream << err.what();
+    }
+  }
+
   // A shared "fromJson" implementation. Extracted here for UTs + coverage.
   template<typename Type>
-  bool fromJsonHelper(const std::string &string, Type &obj, std::string *error_message = nullptr) {
+  bool fromJsonHelper(const std::string_view string, Type &obj, std::string *error_message = nullptr) {
     try {
       if (error_message) {
         error_message->clear();
@@ -73,12 +101,88 @@ namespace display_device {
     }
   }
 
+  // A shared "toCbor" implementation. Extracted here for UTs + coverage.
+  template<typename Type>
+  std::optional<std::vector<std::uint8_t>> toCborHelper(const Type &obj, std::string *error_message = nullptr) {
+    try {
+      if (error_message) {
+        error_message->clear();
+      }
+
+      const nlohmann::json json_obj = obj;
+      return nlohmann::json::to_cbor(json_obj);
+    } catch (const nlohmann::json::exception &err) {  // GCOVR_EXCL_BR_LINE for fallthrough branch
+      if (error_message) {
+        *error_message = err.what();
+      }
+
+      return std::nullopt;
+    } catch (const std::out_of_range &err) {  // GCOVR_EXCL_BR_LINE for fallthrough branch
+      if (error_message) {
+        *error_message = err.what();
+      }
+
+      return std::nullopt;
+    } catch (const std::invalid_argument &err) {  // GCOVR_EXCL_BR_LINE for fallthrough branch
+      if (error_message) {
+        *error_message = err.what();
+      }
+
+      return std::nullopt;
+    }
+  }
+
+  // A shared "fromCbor" implementation. Extracted here for UTs + coverage.
+  template<typename Type>
+  bool fromCborHelper(const std::span<const std::uint8_t> data, Type &obj, std::string *error_message = nullptr) {
+    try {
+      if (error_message) {
+        error_message->clear();
+      }
+
+      Type parsed_obj = nlohmann::json::from_cbor(std::begin(data), std::end(data));
+      obj = std::move(parsed_obj);
+      return true;
+    } catch (const nlohmann::json::exception &err) {
+      if (error_message) {
+        *error_message = err.what();
+      }
+
+      return false;
+    } catch (const std::out_of_range &err) {
+      if (error_message) {
+        *error_message = err.what();
+      }
+
+      return false;
+    } catch (const std::invalid_argument &err) {
+      if (error_message) {
+        *error_message = err.what();
+      }
+
+      return false;
+    }
+  }
+
+  #define DD_JSON_DEFINE_CBOR_CONVERTER(Type) \
+    std::optional<std::vector<std::uint8_t>> toCbor(const Type &obj, std::string *error_message) { \
+      return toCborHelper(obj, error_message); \
+    } \
+    bool fromCbor(const std::span<const std::uint8_t> data, Type &obj, std::string *error_message) { \
+      return fromCborHelper<Type>(data, obj, error_message); \
+    }
+
   #define DD_JSON_DEFINE_CONVERTER(Type) \
     std::string toJson(const Type &obj, const std::optional<unsigned int> &indent, bool *success) { \
       return toJsonHelper(obj, indent, success); \
     } \
-    bool fromJson(const std::string &string, Type &obj, std::string *error_message) { \
+    bool fromJson(const std::string_view string, Type &obj, std::string *error_message) { \
       return fromJsonHelper<Type>(string, obj, error_message); \
+    } \
+    JsonView jsonView(const Type &obj, const std::optional<unsigned int> &indent) { \
+      return JsonView {&obj, indent, [](std::ostream &stream, const void *view_obj, const std::optional<unsigned int> &view_indent) { \
+                         writeJsonHelper(stream, *static_cast<const Type *>(view_obj), view_indent); \
+                       }}; \
     }
 }  // namespace display_device
 #endif
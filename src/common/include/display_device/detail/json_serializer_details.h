@@ -7,18 +7,32 @@
 #ifdef DD_JSON_DETAIL
   // system includes
   #include <algorithm>
+  #include <array>
+  #include <chrono>
+  #include <map>
   #include <nlohmann/json.hpp>
+  #include <numeric>
+  #include <set>
   #include <stdexcept>
+  #include <string>
+  #include <tuple>
+  #include <variant>
+  #include <vector>
+
+  // local includes
+  #include "json_writer.h"
 
   // Special versions of the NLOHMANN definitions to remove the "m_" prefix in string form ('cause I like it that way ;P)
   #define DD_JSON_TO(v1) nlohmann_json_j[#v1] = nlohmann_json_t.m_##v1;
   #define DD_JSON_FROM(v1) nlohmann_json_j.at(#v1).get_to(nlohmann_json_t.m_##v1);
+  #define DD_JSON_MEMBER(v1) JsonMember {#v1, nlohmann_json_t.m_##v1},
 
   // Coverage has trouble with inlined functions when they are included in different units,
   // therefore the usual macro was split into declaration and definition
   #define DD_JSON_DECLARE_SERIALIZE_TYPE(Type) \
     void to_json(nlohmann::json &nlohmann_json_j, const Type &nlohmann_json_t); \
-    void from_json(const nlohmann::json &nlohmann_json_j, Type &nlohmann_json_t);
+    void from_json(const nlohmann::json &nlohmann_json_j, Type &nlohmann_json_t); \
+    void writeJson(JsonWriter &nlohmann_json_w, const Type &nlohmann_json_t);
 
   #define DD_JSON_DEFINE_SERIALIZE_STRUCT(Type, ...) \
     void to_json(nlohmann::json &nlohmann_json_j, const Type &nlohmann_json_t) { \
@@ -27,6 +41,10 @@
 \
     void from_json(const nlohmann::json &nlohmann_json_j, Type &nlohmann_json_t) { \
       NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(DD_JSON_FROM, __VA_ARGS__)) \
+    } \
+\
+    void writeJson(JsonWriter &nlohmann_json_w, const Type &nlohmann_json_t) { \
+      writeJsonObject(nlohmann_json_w, std::tuple {NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(DD_JSON_MEMBER, __VA_ARGS__))}); \
     }
 
   // Coverage has trouble with getEnumMap() function since it has a lot of "fallthrough"
@@ -50,6 +68,12 @@
       nlohmann_json_t = findInEnumMap<Type>(#Type " is missing enum mapping!", [&nlohmann_json_j](const auto &pair) { \
                           return pair.second == nlohmann_json_j; \
                         })->first; \
+    } \
+\
+    void writeJson(JsonWriter &nlohmann_json_w, const Type &nlohmann_json_t) { \
+      writeJson(nlohmann_json_w, findInEnumMap<Type>(#Type " is missing enum mapping!", [nlohmann_json_t](const auto &pair) { \
+                                   return pair.first == nlohmann_json_t; \
+                                 })->second); \
     }
 
 namespace display_device {
@@ -81,6 +105,137 @@ namespace display_device {
     }
   }  // namespace detail
 
+  /**
+   * @brief Types that can be written by the JsonWriter without the `nlohmann::json` object.
+   */
+  template<class T>
+  concept JsonWritable = requires(JsonWriter &writer, const T &value) { writeJson(writer, value); };
+
+  /**
+   * @brief Named struct member for the writeJsonObject.
+   */
+  template<class T>
+  struct JsonMember {
+    std::string_view m_name;  ///< Member name without the "m_" prefix.
+    const T &m_value;  ///< Member value.
+  };
+
+  template<class T>
+  JsonMember(std::string_view, const T &) -> JsonMember<T>;
+
+  // The overloads below are templates so that the types implicitly convertible to them are not considered as writable
+  template<std::integral T>
+  void writeJson(JsonWriter &writer, const T value) {
+    if constexpr (std::same_as<T, bool>) {
+      writer.writeBool(value);
+    } else {
+      writer.writeInteger(value);
+    }
+  }
+
+  template<std::floating_point T>
+  void writeJson(JsonWriter &writer, const T value) {
+    writer.writeDouble(static_cast<double>(value));
+  }
+
+  template<std::same_as<std::string> T>
+  void writeJson(JsonWriter &writer, const T &value) {
+    writer.writeString(value);
+  }
+
+  // Enum mappings are stored as json values
+  template<std::same_as<nlohmann::json> T>
+  void writeJson(JsonWriter &writer, const T &value) {
+    if (value.is_string()) {
+      writer.writeString(value.template get_ref<const std::string &>());
+    } else {
+      writer.writeRaw(value.dump());
+    }
+  }
+
+  template<class Rep, class Period>
+  void writeJson(JsonWriter &writer, const std::chrono::duration<Rep, Period> &value) {
+    writer.writeInteger(value.count());
+  }
+
+  template<JsonWritable T>
+  void writeJson(JsonWriter &writer, const std::optional<T> &value) {
+    if (value) {
+      writeJson(writer, *value);
+    } else {
+      writer.writeNull();
+    }
+  }
+
+  template<JsonWritable T, class Allocator>
+  void writeJson(JsonWriter &writer, const std::vector<T, Allocator> &value) {
+    writer.beginArray();
+    for (const auto &item : value) {
+      writeJson(writer, item);
+    }
+    writer.endArray();
+  }
+
+  template<JsonWritable T, class Compare, class Allocator>
+  void writeJson(JsonWriter &writer, const std::set<T, Compare, Allocator> &value) {
+    writer.beginArray();
+    for (const auto &item : value) {
+      writeJson(writer, item);
+    }
+    writer.endArray();
+  }
+
+  template<JsonWritable T, class Compare, class Allocator>
+  void writeJson(JsonWriter &writer, const std::map<std::string, T, Compare, Allocator> &value) {
+    writer.beginObject();
+    for (const auto &[key, item] : value) {
+      writer.writeKey(key);
+      writeJson(writer, item);
+    }
+    writer.endObject();
+  }
+
+  template<JsonWritable... Ts>
+  void writeJson(JsonWriter &writer, const std::variant<Ts...> &value) {
+    std::visit(
+      [&writer]<class T>(const T &item) {
+        writer.beginObject();
+        writer.writeKey("type");
+        writer.writeString(detail::JsonTypeName<std::decay_t<T>>::m_name);
+        writer.writeKey("value");
+        writeJson(writer, item);
+        writer.endObject();
+      },
+      value
+    );
+  }
+
+  /**
+   * @brief Write the struct members as a JSON object.
+   * @note The members are written in the alphabetical order, the same as in the `nlohmann::json` object.
+   */
+  template<class... Ts>
+  void writeJsonObject(JsonWriter &writer, const std::tuple<JsonMember<Ts>...> &members) {
+    std::apply(
+      [&writer](const auto &...member) {
+        const std::array<std::string_view, sizeof...(Ts)> names {member.m_name...};
+        std::array<std::size_t, sizeof...(Ts)> order {};
+        std::iota(std::begin(order), std::end(order), 0);
+        std::ranges::sort(order, {}, [&names](const auto index) {
+          return names[index];
+        });
+
+        writer.beginObject();
+        for (const auto index : order) {
+          std::size_t member_index {0};
+          ((member_index++ == index ? (writer.writeKey(member.m_name), writeJson(writer, member.m_value)) : void()), ...);
+        }
+        writer.endObject();
+      },
+      members
+    );
+  }
+
   // A shared function for enums to find values in the map. Extracted here for UTs + coverage
   template<class T, class Predicate>
   typename std::map<T, nlohmann::json>::const_iterator findInEnumMap(const char *error_msg, Predicate predicate) {
@@ -0,0 +1,224 @@
+/**
+ * @file src/common/include/display_device/detail/json_writer.h
+ * @brief Declarations for the private streaming JSON writer.
+ */
+#pragma once
+
+#ifdef DD_JSON_DETAIL
+  // system includes
+  #include <array>
+  #include <charconv>
+  #include <concepts>
+  #include <nlohmann/json.hpp>
+  #include <optional>
+  #include <ostream>
+  #include <string_view>
+  #include <vector>
+
+namespace display_device {
+  /**
+   * @brief Writes JSON straight into the output stream without building a `nlohmann::json` object first.
+   *
+   * The output is formatted the same way as `nlohmann::json::dump` formats it.
+   */
+  class JsonWriter {
+  public:
+    /**
+     * @brief Default constructor.
+     * @param stream Stream to write into.
+     * @param indent Indentation width, empty optional for compact output.
+     */
+    JsonWriter(std::ostream &stream, const std::optional<unsigned int> &indent):
+        m_buffer {*stream.rdbuf()},
+        m_indent {indent} {
+    }
+
+    /**
+     * @brief Write the null value.
+     */
+    void writeNull() {
+      beginValue();
+      write("null");
+    }
+
+    /**
+     * @brief Write the boolean value.
+     */
+    void writeBool(const bool value) {
+      beginValue();
+      write(value ? "true" : "false");
+    }
+
+    /**
+     * @brief Write the integer value.
+     */
+    template<std::integral T>
+    void writeInteger(const T value) {
+      beginValue();
+      std::array<char, 24> buffer {};
+      const auto result {std::to_chars(buffer.data(), buffer.data() + buffer.size(), value)};
+      write({buffer.data(), result.ptr});
+    }
+
+    /**
+     * @brief Write the floating point value, or null if it is not finite.
+     */
+    void writeDouble(const double value) {
+      beginValue();
+      // Not `std::to_chars`, since its output differs from the `dump` one (e.g. 1e+15 vs 1000000000000000.0)
+      write(nlohmann::json(value).dump());
+    }
+
+    /**
+     * @brief Write the escaped string value.
+     */
+    void writeString(const std::string_view value) {
+      beginValue();
+      writeEscaped(value);
+    }
+
+    /**
+     * @brief Write the already serialized value as is.
+     */
+    void writeRaw(const std::string_view value) {
+      beginValue();
+      write(value);
+    }
+
+    /**
+     * @brief Open a new object.
+     */
+    void beginObject() {
+      beginValue();
+      m_buffer.sputc('{');
+      m_scopes.push_back(false);
+    }
+
+    /**
+     * @brief Write the key of the next object member.
+     */
+    void writeKey(const std::string_view key) {
+      beginElement();
+      writeEscaped(key);
+      m_buffer.sputc(':');
+      if (m_indent) {
+        m_buffer.sputc(' ');
+      }
+      m_after_key = true;
+    }
+
+    /**
+     * @brief Close the current object.
+     */
+    void endObject() {
+      endScope('}');
+    }
+
+    /**
+     * @brief Open a new array.
+     */
+    void beginArray() {
+      beginValue();
+      m_buffer.sputc('[');
+      m_scopes.push_back(false);
+    }
+
+    /**
+     * @brief Close the current array.
+     */
+    void endArray() {
+      endScope(']');
+    }
+
+  private:
+    void write(const std::string_view value) {
+      m_buffer.sputn(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+
+    void writeNewLine() {
+      m_buffer.sputc('\n');
+      for (std::size_t i {0}; i < m_scopes.size() * *m_indent; ++i) {
+        m_buffer.sputc(' ');
+      }
+    }
+
+    void writeEscaped(const std::string_view value) {
+      m_buffer.sputc('"');
+      for (const char character : value) {
+        switch (character) {
+          case '"':
+            write("\\\"");
+            break;
+          case '\\':
+            write("\\\\");
+            break;
+          case '\b':
+            write("\\b");
+            break;
+          case '\f':
+            write("\\f");
+            break;
+          case '\n':
+            write("\\n");
+            break;
+          case '\r':
+            write("\\r");
+            break;
+          case '\t':
+            write("\\t");
+            break;
+          default:
+            if (static_cast<unsigned char>(character) < 0x20) {
+              constexpr std::string_view hex_digits {"0123456789abcdef"};
+              const std::array<char, 6> escaped {'\\', 'u', '0', '0', hex_digits[static_cast<unsigned char>(character) >> 4], hex_digits[static_cast<unsigned char>(character) & 0xF]};
+              write({escaped.data(), escaped.size()});
+            } else {
+              m_buffer.sputc(character);
+            }
+            break;
+        }
+      }
+      m_buffer.sputc('"');
+    }
+
+    /**
+     * @brief Write the separator before the next member or element of the current scope.
+     */
+    void beginElement() {
+      if (m_scopes.back()) {
+        m_buffer.sputc(',');
+      }
+      m_scopes.back() = true;
+      if (m_indent) {
+        writeNewLine();
+      }
+    }
+
+    void beginValue() {
+      if (m_after_key) {
+        m_after_key = false;
+        return;
+      }
+
+      // Values in arrays need the separator, the top-level value does not
+      if (!m_scopes.empty()) {
+        beginElement();
+      }
+    }
+
+    void endScope(const char closing_character) {
+      const bool has_elements {m_scopes.back()};
+      m_scopes.pop_back();
+      if (has_elements && m_indent) {
+        writeNewLine();
+      }
+      m_buffer.sputc(closing_character);
+    }
+
+    std::streambuf &m_buffer;  ///< Buffer of the stream to write into.
+    std::optional<unsigned int> m_indent;  ///< Indentation width, empty optional for compact output.
+    std::vector<bool> m_scopes;  ///< Whether the currently open objects/arrays have any elements.
+    bool m_after_key {false};  ///< Whether the next value belongs to the key that has just been written.
+  };
+}  // namespace display_device
+#endif
@@ -5,9 +5,14 @@
 #pragma once
 
 // system includes
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <format>
 #include <iterator>
 #include <optional>
+#include <span>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -16,6 +21,114 @@
 #include "display_device/settings_persistence_interface.h"
 
 namespace display_device::detail {
+  /**
+   * @brief Magic bytes at the beginning of the binary encoded state.
+   * @note The first byte cannot start a JSON text, so the JSON encoded state is never mistaken for the binary one.
+   */
+  constexpr std::array<std::uint8_t, 4> BINARY_STATE_MAGIC {0xDD, 'D', 'S', 'T'};
+
+  /**
+   * @brief Version of the binary encoded state, stored right after the magic bytes.
+   */
+  constexpr std::uint8_t BINARY_STATE_VERSION {1};
+
+  /**
+   * @brief Encode the state for storing.
+   * @tparam State State type with the JSON and CBOR converters.
+   * @param state State to encode.
+   * @param encoding Encoding to be used.
+   * @param error_message Set to the error message on failure.
+   * @return Encoded state, or empty optional on failure.
+   */
+  template<typename State>
+  [[nodiscard]] std::optional<std::vector<std::uint8_t>> encodeState(const State &state, const PersistenceEncoding encoding, std::string &error_message) {
+    if (encoding == PersistenceEncoding::Binary) {
+      const auto payload {toCbor(state, &error_message)};
+      if (!payload) {
+        return std::nullopt;
+      }
+
+      std::vector<std::uint8_t> data;
+      data.reserve(BINARY_STATE_MAGIC.size() + 1 + payload->size());
+      data.insert(std::end(data), std::begin(BINARY_STATE_MAGIC), std::end(BINARY_STATE_MAGIC));
+      data.push_back(BINARY_STATE_VERSION);
+      data.insert(std::end(data), std::begin(*payload), std::end(*payload));
+      return data;
+    }
+
+    bool success {false};
+    const auto json_string {toJson(state, 2, &success)};
+    if (!success) {
+      error_message = json_string;
+      return std::nullopt;
+    }
+    return std::vector<std::uint8_t> {std::begin(json_string), std::end(json_string)};
+  }
+
+  /**
+   * @brief Decode the stored state, detecting the encoding automatically.
+   * @tparam State State type with the JSON and CBOR converters.
+   * @param data Encoded state.
+   * @param state Set to the decoded state on success.
+   * @param error_message Set to the error message on failure.
+   * @return True on success, false otherwise.
+   */
+  template<typename State>
+  [[nodiscard]] bool decodeState(const std::span<const std::uint8_t> data, State &state, std::string &error_message) {
+    if (data.size() >= BINARY_STATE_MAGIC.size() && std::ranges::equal(data.first(BINARY_STATE_MAGIC.size()), BINARY_STATE_MAGIC)) {
+      const auto payload {data.subspan(BINARY_STATE_MAGIC.size())};
+      if (payload.empty() || payload.front() != BINARY_STATE_VERSION) {
+        error_message = payload.empty() ? std::string {"Binary state is missing the version!"} : std::format("Unsupported binary state version {}!", payload.front());
+        return false;
+      }
+
+      return fromCbor(payload.subspan(1), state, &error_message);
+    }
+
+    return fromJson({reinterpret_cast<const char *>(data.data()), data.size()}, state, &error_message);
+  }
+
+  /**
+   * @brief Load and decode the stored state.
+   * @tparam State State type with the JSON and CBOR converters.
+   * @tparam LoadException Exception type thrown on failure.
+   * @param settings_persistence_api Persistence API used to load the state.
+   * @param throw_on_load_error Specify whether to throw or to log the error on failure.
+   * @param load_error_message Error message used when loading fails.
+   * @param parse_error_message Error message used when decoding fails.
+   * @return Decoded state, or empty optional if there is no stored state or it failed to load (and throwing is disabled).
+   * @throws LoadException if the state failed to load and throwing is enabled.
+   */
+  template<typename State, typename LoadException>
+  [[nodiscard]] std::optional<State> loadState(
+    const SettingsPersistenceInterface &settings_persistence_api,
+    const bool throw_on_load_error,
+    const std::string_view load_error_message,
+    const std::string_view parse_error_message
+  ) {
+    std::string error_message;
+    if (const auto persistent_settings {settings_persistence_api.loadView()}) {
+      if (persistent_settings->empty()) {
+        return std::nullopt;
+      }
+
+      State state {};
+      if (decodeState(persistent_settings->getData(), state, error_message)) {
+        return state;
+      }
+      error_message = std::string {parse_error_message} + "\n" + error_message;
+    } else {
+      error_message = load_error_message;
+    }
+
+    if (throw_on_load_error) {
+      throw LoadException {error_message};
+    }
+
+    DD_LOG_CAT(persistence, error) << error_message;
+    return std::nullopt;
+  }
+
   /**
    * @brief Persist state and update the cached copy after a successful write.
    * @tparam State Cached state type.
@@ -23,7 +136,7 @@ namespace display_device::detail {
    * @param settings_persistence_api Persistence API used to store or clear state.
    * @param cached_state Cached state to compare and update.
    * @param state New state to persist.
-   * @param serialize_state Callable that serializes a state and updates a success flag.
+   * @param serialize_state Callable that serializes a state into bytes, or returns empty optional and sets the error message.
    * @param serialize_error_message Error message used when serialization fails.
    * @return True if the state was already current or was persisted successfully, false otherwise.
    */
@@ -48,15 +161,15 @@ namespace display_device::detail {
       return true;
     }
 
-    bool success {false};
-    const auto serialized_state {serialize_state(*state, success)};
-    if (!success) {
-      DD_LOG(error) << serialize_error_message << "\n"
-                    << serialized_state;
+    std::string error_message;
+    const auto serialized_state {serialize_state(*state, error_message)};
+    if (!serialized_state) {
+      DD_LOG_CAT(persistence, error) << serialize_error_message << "\n"
+                                     << error_message;
       return false;
     }
 
-    if (!settings_persistence_api.store({std::begin(serialized_state), std::end(serialized_state)})) {
+    if (!settings_persistence_api.store(*serialized_state)) {
       return false;
     }
 
@@ -23,6 +23,8 @@ namespace display_device {
     std::shared_ptr<AudioContextInterface> m_audio_context_api {};  ///< Optional audio context interface.
     std::shared_ptr<SettingsPersistenceInterface> m_settings_persistence_api {};  ///< Optional settings persistence interface.
     bool m_throw_on_persistence_load_error {};  ///< Throw when persisted settings cannot be loaded or parsed.
+    PersistenceEncoding m_persistence_encoding {PersistenceEncoding::Json};  ///< Encoding for storing the persisted settings. Both encodings are always loadable.
+    PersistenceLoadMode m_persistence_load_mode {PersistenceLoadMode::Eager};  ///< When the persisted settings are loaded. In the lazy mode, the load error is thrown by the first settings manager call that needs the state.
     std::optional<std::chrono::milliseconds> m_hdr_blank_delay {};  ///< Optional HDR blanking workaround delay on supported platforms.
   };
 
@@ -6,6 +6,7 @@
 
 // system includes
 #include <filesystem>
+#include <mutex>
 
 // local includes
 #include "settings_persistence_interface.h"
@@ -17,14 +18,27 @@ namespace display_device {
    */
   class FileSettingsPersistence: public SettingsPersistenceInterface {
   public:
+    /**
+     * @brief Defines how the data is written to the file.
+     */
+    enum class StoreMode {
+      Direct,  ///< The file is truncated and rewritten in place. A crash during the write leaves a partially written file.
+      Durable  ///< The data is written to a temporary file next to the target, flushed to the disk and atomically renamed over the target.
+    };
+
     /**
      * Default constructor. Does not perform any operations on the file yet.
      * @param filepath A non-empty filepath. Throws on empty.
+     * @param store_mode Specify how the data is written to the file.
      */
-    explicit FileSettingsPersistence(std::filesystem::path filepath);
+    explicit FileSettingsPersistence(std::filesystem::path filepath, StoreMode store_mode = StoreMode::Durable);
 
     /**
      * @copydoc SettingsPersistenceInterface::store
+     * @note Every call writes the file. To coalesce frequent stores, wrap the instance in
+     *       the WriteBehindSettingsPersistence.
+     * @note In the durable mode, the file either contains the previous or the new data, even if the
+     *       process or the system crashes during the write.
      * @warning The method does not create missing directories!
      */
     [[nodiscard]] bool store(const std::vector<std::uint8_t> &data) override;
@@ -33,6 +47,7 @@ namespace display_device {
      * @copydoc SettingsPersistenceInterface::load
      * @note If file does not exist, an empty data list will be returned instead of null optional.
      * @note If the path exists but is not a regular file, null optional will be returned.
+     * @note The file is read with a single call into a buffer sized upfront.
      */
     [[nodiscard]] std::optional<std::vector<std::uint8_t>> load() const override;
 
@@ -43,5 +58,7 @@ namespace display_device {
 
   private:
     std::filesystem::path m_filepath;
+    StoreMode m_store_mode;  ///< How the data is written to the file.
+    std::mutex m_mutex {};  ///< Serializes the stores and clears of this instance.
   };
 }  // namespace display_device
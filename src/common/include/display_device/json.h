@@ -5,7 +5,14 @@
 #pragma once
 
 // system includes
+#include <cstdint>
+#include <optional>
+#include <ostream>
 #include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
 
 // local includes
 #include "types.h"
@@ -19,7 +26,22 @@
  */
 #define DD_JSON_DECLARE_CONVERTER(Type) \
   [[nodiscard]] std::string toJson(const Type &obj, const std::optional<unsigned int> &indent = 2u, bool *success = nullptr); \
-  [[nodiscard]] bool fromJson(const std::string &string, Type &obj, std::string *error_message = nullptr);  // NOLINT(*-macro-parentheses)
+  [[nodiscard]] JsonView jsonView(const Type &obj, const std::optional<unsigned int> &indent = 2u); \
+  [[nodiscard]] bool fromJson(std::string_view string, Type &obj, std::string *error_message = nullptr);  // NOLINT(*-macro-parentheses)
+
+/**
+ * @brief Helper MACRO to declare the toCbor and fromCbor converters for a type.
+ *
+ * CBOR is the binary counterpart of JSON - it has the same structure, but it is more compact and faster to parse.
+ *
+ * @examples
+ * SingleDisplayConfigState state;
+ * const auto data {toCbor(state)};
+ * @examples_end
+ */
+#define DD_JSON_DECLARE_CBOR_CONVERTER(Type) \
+  [[nodiscard]] std::optional<std::vector<std::uint8_t>> toCbor(const Type &obj, std::string *error_message = nullptr); \
+  [[nodiscard]] bool fromCbor(std::span<const std::uint8_t> data, Type &obj, std::string *error_message = nullptr);  // NOLINT(*-macro-parentheses)
 
 // Shared converters (add as needed)
 namespace display_device {
@@ -28,6 +50,56 @@ namespace display_device {
    */
   extern const std::optional<unsigned int> JSON_COMPACT;
 
+  /**
+   * @brief Object that is serialized only once it is streamed, straight into the stream.
+   *
+   * Unlike `toJson`, neither the intermediate `nlohmann::json` object nor the string is built,
+   * which makes it cheap to use within the log statements.
+   *
+   * @note The viewed object must outlive the view.
+   * @note On a serialization error, the error message is streamed instead (after the partial output).
+   * @examples
+   * EnumeratedDeviceList devices;
+   * DD_LOG(info) << "Got devices:\n" << jsonView(devices);
+   * @examples_end
+   */
+  class JsonView {
+  public:
+    /**
+     * @brief Function that serializes the viewed object into the stream.
+     */
+    using WriteFn = void (*)(std::ostream &stream, const void *obj, const std::optional<unsigned int> &indent);
+
+    /**
+     * @brief Default constructor.
+     * @param obj Object to be serialized.
+     * @param indent Optional indentation width. Use JSON_COMPACT for compact output.
+     * @param write_fn Function that serializes the object.
+     * @note The `jsonView` functions should be used instead.
+     */
+    JsonView(const void *obj, const std::optional<unsigned int> &indent, WriteFn write_fn):
+        m_obj {obj},
+        m_indent {indent},
+        m_write_fn {write_fn} {
+    }
+
+    /**
+     * @brief Serialize the viewed object into the stream.
+     * @param stream Stream to write into.
+     * @param view View to be serialized.
+     * @returns Reference to the stream.
+     */
+    friend std::ostream &operator<<(std::ostream &stream, const JsonView &view) {
+      view.m_write_fn(stream, view.m_obj, view.m_indent);
+      return stream;
+    }
+
+  private:
+    const void *m_obj;  ///< Object to be serialized.
+    std::optional<unsigned int> m_indent;  ///< Indentation width.
+    WriteFn m_write_fn;  ///< Function that serializes the object.
+  };
+
   /**
    * @brief Serialize EDID data to JSON.
    * @param obj Object to serialize.
@@ -37,6 +109,14 @@ namespace display_device {
    */
   [[nodiscard]] std::string toJson(const EdidData &obj, const std::optional<unsigned int> &indent = 2u, bool *success = nullptr);
 
+  /**
+   * @brief Create a lazily serialized view of EDID data.
+   * @param obj Object to serialize. Must outlive the view.
+   * @param indent Optional indentation width. Use JSON_COMPACT for compact output.
+   * @returns View to be streamed.
+   */
+  [[nodiscard]] JsonView jsonView(const EdidData &obj, const std::optional<unsigned int> &indent = 2u);
+
   /**
    * @brief Deserialize EDID data from JSON.
    * @param string JSON string to parse.
@@ -44,7 +124,7 @@ namespace display_device {
    * @param error_message Optional output error message.
    * @returns True on success, false otherwise.
    */
-  [[nodiscard]] bool fromJson(const std::string &string, EdidData &obj, std::string *error_message = nullptr);
+  [[nodiscard]] bool fromJson(std::string_view string, EdidData &obj, std::string *error_message = nullptr);
 
   /**
    * @brief Serialize an enumerated device to JSON.
@@ -55,6 +135,14 @@ namespace display_device {
    */
   [[nodiscard]] std::string toJson(const EnumeratedDevice &obj, const std::optional<unsigned int> &indent = 2u, bool *success = nullptr);
 
+  /**
+   * @brief Create a lazily serialized view of an enumerated device.
+   * @param obj Object to serialize. Must outlive the view.
+   * @param indent Optional indentation width. Use JSON_COMPACT for compact output.
+   * @returns View to be streamed.
+   */
+  [[nodiscard]] JsonView jsonView(const EnumeratedDevice &obj, const std::optional<unsigned int> &indent = 2u);
+
   /**
    * @brief Deserialize an enumerated device from JSON.
    * @param string JSON string to parse.
@@ -62,7 +150,7 @@ namespace display_device {
    * @param error_message Optional output error message.
    * @returns True on success, false otherwise.
    */
-  [[nodiscard]] bool fromJson(const std::string &string, EnumeratedDevice &obj, std::string *error_message = nullptr);
+  [[nodiscard]] bool fromJson(std::string_view string, EnumeratedDevice &obj, std::string *error_message = nullptr);
 
   /**
    * @brief Serialize an enumerated device list to JSON.
@@ -73,6 +161,14 @@ namespace display_device {
    */
   [[nodiscard]] std::string toJson(const EnumeratedDeviceList &obj, const std::optional<unsigned int> &indent = 2u, bool *success = nullptr);
 
+  /**
+   * @brief Create a lazily serialized view of an enumerated device list.
+   * @param obj Object to serialize. Must outlive the view.
+   * @param indent Optional indentation width. Use JSON_COMPACT for compact output.
+   * @returns View to be streamed.
+   */
+  [[nodiscard]] JsonView jsonView(const EnumeratedDeviceList &obj, const std::optional<unsigned int> &indent = 2u);
+
   /**
    * @brief Deserialize an enumerated device list from JSON.
    * @param string JSON string to parse.
@@ -80,7 +176,7 @@ namespace display_device {
    * @param error_message Optional output error message.
    * @returns True on success, false otherwise.
    */
-  [[nodiscard]] bool fromJson(const std::string &string, EnumeratedDeviceList &obj, std::string *error_message = nullptr);
+  [[nodiscard]] bool fromJson(std::string_view string, EnumeratedDeviceList &obj, std::string *error_message = nullptr);
 
   /**
    * @brief Serialize a single display configuration to JSON.
@@ -91,6 +187,14 @@ namespace display_device {
    */
   [[nodiscard]] std::string toJson(const SingleDisplayConfiguration &obj, const std::optional<unsigned int> &indent = 2u, bool *success = nullptr);
 
+  /**
+   * @brief Create a lazily serialized view of a single display configuration.
+   * @param obj Object to serialize. Must outlive the view.
+   * @param indent Optional indentation width. Use JSON_COMPACT for compact output.
+   * @returns View to be streamed.
+   */
+  [[nodiscard]] JsonView jsonView(const SingleDisplayConfiguration &obj, const std::optional<unsigned int> &indent = 2u);
+
   /**
    * @brief Deserialize a single display configuration from JSON.
    * @param string JSON string to parse.
@@ -98,7 +202,7 @@ namespace display_device {
    * @param error_message Optional output error message.
    * @returns True on success, false otherwise.
    */
-  [[nodiscard]] bool fromJson(const std::string &string, SingleDisplayConfiguration &obj, std::string *error_message = nullptr);
+  [[nodiscard]] bool fromJson(std::string_view string, SingleDisplayConfiguration &obj, std::string *error_message = nullptr);
 
   /**
    * @brief Serialize a string set to JSON.
@@ -109,6 +213,14 @@ namespace display_device {
    */
   [[nodiscard]] std::string toJson(const StringSet &obj, const std::optional<unsigned int> &indent = 2u, bool *success = nullptr);
 
+  /**
+   * @brief Create a lazily serialized view of a string set.
+   * @param obj Object to serialize. Must outlive the view.
+   * @param indent Optional indentation width. Use JSON_COMPACT for compact output.
+   * @returns View to be streamed.
+   */
+  [[nodiscard]] JsonView jsonView(const StringSet &obj, const std::optional<unsigned int> &indent = 2u);
+
   /**
    * @brief Deserialize a string set from JSON.
    * @param string JSON string to parse.
@@ -116,7 +228,7 @@ namespace display_device {
    * @param error_message Optional output error message.
    * @returns True on success, false otherwise.
    */
-  [[nodiscard]] bool fromJson(const std::string &string, StringSet &obj, std::string *error_message = nullptr);
+  [[nodiscard]] bool fromJson(std::string_view string, StringSet &obj, std::string *error_message = nullptr);
 
   /**
    * @brief Serialize a string to JSON.
@@ -127,6 +239,14 @@ namespace display_device {
    */
   [[nodiscard]] std::string toJson(const std::string &obj, const std::optional<unsigned int> &indent = 2u, bool *success = nullptr);
 
+  /**
+   * @brief Create a lazily serialized view of a string.
+   * @param obj Object to serialize. Must outlive the view.
+   * @param indent Optional indentation width. Use JSON_COMPACT for compact output.
+   * @returns View to be streamed.
+   */
+  [[nodiscard]] JsonView jsonView(const std::string &obj, const std::optional<unsigned int> &indent = 2u);
+
   /**
    * @brief Deserialize a string from JSON.
    * @param string JSON string to parse.
@@ -134,7 +254,7 @@ namespace display_device {
    * @param error_message Optional output error message.
    * @returns True on success, false otherwise.
    */
-  [[nodiscard]] bool fromJson(const std::string &string, std::string &obj, std::string *error_message = nullptr);
+  [[nodiscard]] bool fromJson(std::string_view string, std::string &obj, std::string *error_message = nullptr);
 
   /**
    * @brief Serialize a boolean to JSON.
@@ -145,6 +265,14 @@ namespace display_device {
    */
   [[nodiscard]] std::string toJson(const bool &obj, const std::optional<unsigned int> &indent = 2u, bool *success = nullptr);
 
+  /**
+   * @brief Create a lazily serialized view of a boolean.
+   * @param obj Object to serialize. Must outlive the view.
+   * @param indent Optional indentation width. Use JSON_COMPACT for compact output.
+   * @returns View to be streamed.
+   */
+  [[nodiscard]] JsonView jsonView(const bool &obj, const std::optional<unsigned int> &indent = 2u);
+
   /**
    * @brief Deserialize a boolean from JSON.
    * @param string JSON string to parse.
@@ -152,5 +280,5 @@ namespace display_device {
    * @param error_message Optional output error message.
    * @returns True on success, false otherwise.
    */
-  [[nodiscard]] bool fromJson(const std::string &string, bool &obj, std::string *error_message = nullptr);
+  [[nodiscard]] bool fromJson(std::string_view string, bool &obj, std::string *error_message = nullptr);
 }  // namespace display_device
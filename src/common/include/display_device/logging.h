@@ -5,11 +5,83 @@
 #pragma once
 
 // system includes
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
 #include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#ifndef DD_LOG_MIN_LEVEL
+  /**
+   * @brief Numeric value of the lowest `Logger::LogLevel` for which the `DD_LOG` and `DD_LOGF` statements are compiled.
+   *
+   * Statements below this level compile down to nothing, so neither the singleton is accessed nor
+   * the runtime level is checked for them. Set via the `DD_LOG_MIN_LEVEL` CMake option.
+   */
+  #define DD_LOG_MIN_LEVEL 0
+#endif
 
 namespace display_device {
+  class TraceArguments;
+  class TraceSink;
+  struct TraceFormat;
+
+  namespace detail {
+    class FormatBufferLease;
+
+    /**
+     * @brief Acquire the buffer for the `Logger::writeFormatted` calls of the current thread.
+     * @returns Lease of the thread's buffer, or of a fresh one if the thread's buffer is already leased (nested call).
+     */
+    [[nodiscard]] FormatBufferLease acquireFormatBuffer();
+
+    /**
+     * @brief Exclusive access to a format buffer, released on destruction.
+     *
+     * Each thread has a single buffer that is reused by all the `Logger::writeFormatted` calls,
+     * so that no heap allocation is needed once the buffer has grown large enough.
+     */
+    class FormatBufferLease {
+    public:
+      ~FormatBufferLease();
+      FormatBufferLease(const FormatBufferLease &) = delete;
+      FormatBufferLease &operator=(const FormatBufferLease &) = delete;
+
+      /**
+       * @brief Get the leased buffer.
+       * @returns Reference to the buffer.
+       */
+      [[nodiscard]] std::string &get() const;
+
+    private:
+      friend FormatBufferLease acquireFormatBuffer();
+
+      /**
+       * @brief Lease the buffer.
+       * @param buffer Thread's buffer, or nullptr if it is already leased.
+       */
+      explicit FormatBufferLease(std::string *buffer);
+
+      std::string *m_buffer;  ///< Thread's buffer, or nullptr if the own buffer is used.
+      mutable std::string m_own_buffer;  ///< Buffer for the nested calls.
+    };
+  }  // namespace detail
+
   /**
    * @brief A singleton class for logging or re-routing logs.
    *
@@ -34,10 +106,144 @@ namespace display_device {
       fatal  ///< Fatal level
     };
 
+    /**
+     * @brief Defines the log categories that can have their own log level.
+     * @note All categories are in lower-case on purpose to fit the "DD_LOG_CAT(scheduler, info)" style.
+     */
+    enum class LogCategory {
+      general = 0,  ///< Everything that does not belong to a specific category
+      scheduler,  ///< Retry scheduling
+      persistence,  ///< Settings persistence
+      topology,  ///< Display topology and primary display changes
+      modes,  ///< Display mode changes
+      hdr,  ///< HDR state changes
+      power  ///< Display power changes
+    };
+
+    /**
+     * @brief Number of the log categories.
+     */
+    static constexpr std::size_t m_category_count {static_cast<std::size_t>(LogCategory::power) + 1};
+
+    /**
+     * @brief Typed value of a structured log field.
+     */
+    using FieldValue = std::variant<bool, std::int64_t, std::uint64_t, double, std::string>;
+
+    /**
+     * @brief A key/value pair attached to a structured log record.
+     */
+    struct Field {
+      /**
+       * @brief Create the field from any boolean, arithmetic, enum or string-like value.
+       * @param key Name of the field.
+       * @param value Value of the field. Signed integers and enums are stored as `std::int64_t`,
+       *              unsigned integers as `std::uint64_t` and floating point values as `double`.
+       */
+      template<class T>
+      Field(const std::string_view key, T &&value):
+          m_key {key},
+          m_value {makeValue(std::forward<T>(value))} {
+      }
+
+      std::string m_key;  ///< Name of the field.
+      FieldValue m_value;  ///< Value of the field.
+
+    private:
+      /**
+       * @brief Map the value to the matching variant alternative.
+       */
+      template<class T>
+      static FieldValue makeValue(T &&value) {
+        using ValueT = std::remove_cvref_t<T>;
+        if constexpr (std::is_same_v<ValueT, bool>) {
+          return value;
+        } else if constexpr (std::is_enum_v<ValueT>) {
+          return static_cast<std::int64_t>(value);
+        } else if constexpr (std::is_integral_v<ValueT> && std::is_signed_v<ValueT>) {
+          return static_cast<std::int64_t>(value);
+        } else if constexpr (std::is_integral_v<ValueT>) {
+          return static_cast<std::uint64_t>(value);
+        } else if constexpr (std::is_floating_point_v<ValueT>) {
+          return static_cast<double>(value);
+        } else {
+          static_assert(std::is_constructible_v<std::string, T>, "Unsupported log field value type!");
+          return std::string {std::forward<T>(value)};
+        }
+      }
+    };
+
+    /**
+     * @brief A log record as passed to the record callback.
+     * @note The record only references the data, which is valid for the duration of the call.
+     */
+    struct Record {
+      LogCategory m_category;  ///< Category of the record.
+      LogLevel m_level;  ///< Log level of the record.
+      std::string_view m_message;  ///< Message of the record.
+      std::span<const Field> m_fields;  ///< Structured fields of the record (if any).
+    };
+
     /**
      * @brief Defines the callback type for log data re-routing.
+     * @note The string view is only valid for the duration of the call.
      */
-    using Callback = std::function<void(LogLevel, std::string)>;
+    using Callback = std::function<void(LogLevel, std::string_view)>;
+
+    /**
+     * @brief Defines the callback type for structured log record re-routing.
+     */
+    using RecordCallback = std::function<void(const Record &)>;
+
+    /**
+     * @brief Defines the timestamp format used by the default output.
+     */
+    enum class TimestampFormat {
+      LocalTime,  ///< Local wall-clock time, e.g. "[2024-01-31 13:45:07.123]".
+      UtcIso8601,  ///< UTC wall-clock time in ISO-8601, e.g. "[2024-01-31T12:45:07.123Z]". Skips the timezone conversion.
+      Monotonic  ///< Seconds of the monotonic clock, e.g. "[8523.123]". Not affected by the wall-clock adjustments.
+    };
+
+    /**
+     * @brief Defines what happens when the asynchronous queue is full.
+     */
+    enum class AsyncFullPolicy {
+      Drop,  ///< The record is dropped and counted (see `getDroppedCount`).
+      Block  ///< The logging thread waits for a free slot.
+    };
+
+    /**
+     * @brief Configuration for the asynchronous logging mode.
+     */
+    struct AsyncOptions {
+      std::size_t m_capacity {1024};  ///< Number of records that can be queued. Must be a power of 2 larger than 1.
+      AsyncFullPolicy m_full_policy {AsyncFullPolicy::Drop};  ///< What to do when the queue is full.
+    };
+
+    /**
+     * @brief A log record as passed to the batch callback.
+     */
+    struct BatchRecord {
+      LogCategory m_category {};  ///< Category of the record.
+      LogLevel m_level {};  ///< Log level of the record.
+      std::chrono::nanoseconds m_timestamp {};  ///< Time since the epoch of the clock selected via `setTimestampFormat` (steady clock for `TimestampFormat::Monotonic`, system clock otherwise).
+      std::string m_text {};  ///< Message of the record with the structured fields (if any) appended as `key=value` pairs.
+    };
+
+    /**
+     * @brief Defines the callback type for batched log data re-routing.
+     * @note The records are only valid for the duration of the call.
+     */
+    using BatchCallback = std::function<void(std::span<const BatchRecord>)>;
+
+    /**
+     * @brief Configuration for the batched callback delivery.
+     */
+    struct BatchOptions {
+      std::size_t m_max_records {64};  ///< Number of the pending records that triggers the delivery. Must be larger than 0.
+      std::size_t m_max_bytes {64 * 1024};  ///< Total text size of the pending records that triggers the delivery.
+      std::chrono::milliseconds m_flush_interval {100};  ///< Maximum time the first pending record waits for the delivery. Must be positive.
+    };
 
     /**
      * @brief Get the singleton instance.
@@ -51,42 +257,294 @@ namespace display_device {
     /**
      * @brief Set the log level for the logger.
      * @param log_level New level to be used.
+     * @note Can be called at any time, the change is picked up by the logging threads right away.
      * @examples
      * Logger::get().setLogLevel(Logger::LogLevel::Info);
      * @examples_end
      */
     void setLogLevel(LogLevel log_level);
 
+    /**
+     * @brief Set the log level for the category, overriding the global log level.
+     * @param category Category to set the level for.
+     * @param log_level New level to be used.
+     * @examples
+     * Logger::get().setLogLevel(Logger::LogCategory::scheduler, Logger::LogLevel::debug);
+     * @examples_end
+     */
+    void setLogLevel(LogCategory category, LogLevel log_level);
+
+    /**
+     * @brief Make the category follow the global log level again.
+     * @param category Category to reset the level for.
+     * @examples
+     * Logger::get().resetLogLevel(Logger::LogCategory::scheduler);
+     * @examples_end
+     */
+    void resetLogLevel(LogCategory category);
+
     /**
      * @brief Check if log level is currently enabled.
      * @param log_level Log level to check.
      * @returns True if log level is enabled.
+     * @note Same as checking the `LogCategory::general` category.
      * @examples
      * const bool is_enabled { Logger::get().isLogLevelEnabled(Logger::LogLevel::Info) };
      * @examples_end
      */
     [[nodiscard]] bool isLogLevelEnabled(LogLevel log_level) const;
 
+    /**
+     * @brief Check if log level is currently enabled for the category.
+     * @param category Category to check.
+     * @param log_level Log level to check.
+     * @returns True if log level is enabled.
+     * @examples
+     * const bool is_enabled { Logger::get().isLogLevelEnabled(Logger::LogCategory::scheduler, Logger::LogLevel::debug) };
+     * @examples_end
+     */
+    [[nodiscard]] bool isLogLevelEnabled(LogCategory category, LogLevel log_level) const;
+
+    /**
+     * @brief Set the timestamp format for the default output.
+     * @param format New format to be used.
+     * @examples
+     * Logger::get().setTimestampFormat(Logger::TimestampFormat::UtcIso8601);
+     * @examples_end
+     */
+    void setTimestampFormat(TimestampFormat format);
+
     /**
      * @brief Set custom callback for writing the logs.
+     *
+     * Can be called while other threads are logging. The new callback is used by the records
+     * written after the call, while the previous one is destroyed only after its in-flight
+     * invocations have finished.
+     *
      * @param callback New callback to be used or nullptr to reset to the default.
+     * @warning Must not be called from within the callback itself, as it would wait for itself to finish.
      * @examples
-     * Logger::get().setCustomCallback([](const LogLevel level, std::string value){
+     * Logger::get().setCustomCallback([](const LogLevel level, std::string_view value){
      *    // write to file or something
      * });
      * @examples_end
      */
     void setCustomCallback(Callback callback);
 
+    /**
+     * @brief Set custom callback for receiving the structured log records.
+     *
+     * If set, it receives all of the records (including the plain text ones) instead of the custom
+     * callback or the default output. Can be replaced while other threads are logging, the same
+     * as the custom callback.
+     *
+     * @param callback New callback to be used or nullptr to reset.
+     * @warning Must not be called from within the callback itself, as it would wait for itself to finish.
+     * @examples
+     * Logger::get().setRecordCallback([](const Logger::Record &record){
+     *    // index the record.m_fields
+     * });
+     * @examples_end
+     */
+    void setRecordCallback(RecordCallback callback);
+
+    /**
+     * @brief Set custom callback for receiving the log records in batches.
+     *
+     * If set, it receives the records instead of the custom callback or the default output (the
+     * record callback still takes precedence). The records are collected and delivered from
+     * a background thread once the size threshold is reached or the flush interval elapses,
+     * so that the callback is invoked far less often than once per record. The `fatal` records
+     * and `flush` deliver the pending records right away. Can be replaced while other threads
+     * are logging, the same as the custom callback, in which case the pending records are
+     * delivered to the previous callback.
+     *
+     * @param callback New callback to be used or nullptr to reset.
+     * @param options Configuration for the batching. Ignored if the callback is nullptr.
+     * @throws std::invalid_argument if the options are invalid.
+     * @warning Must not be called from within the callback itself, as it would wait for itself to finish.
+     * @examples
+     * Logger::get().setBatchCallback([](std::span<const Logger::BatchRecord> records){
+     *    // send all of the records at once
+     * }, { .m_max_records = 128, .m_flush_interval = std::chrono::milliseconds{250} });
+     * @examples_end
+     */
+    void setBatchCallback(BatchCallback callback, const BatchOptions &options);
+
+    /**
+     * @brief Set the sink for capturing the `DD_TRACE` records.
+     *
+     * The trace records are independent of the log levels and the other callbacks. Can be
+     * replaced while other threads are tracing, the same as the custom callback.
+     *
+     * @param sink New sink to be used or nullptr to stop the tracing.
+     * @examples
+     * Logger::get().setTraceSink(std::make_shared<TraceSink>("trace.bin", TraceSink::Options {}));
+     * @examples_end
+     */
+    void setTraceSink(std::shared_ptr<TraceSink> sink);
+
+    /**
+     * @brief Check whether the trace sink is set.
+     * @returns True if the `DD_TRACE` records are captured, false otherwise.
+     */
+    [[nodiscard]] bool isTraceEnabled() const;
+
+    /**
+     * @brief Pass the trace record to the trace sink (if any).
+     * @param format Format of the record.
+     * @param arguments Encoded arguments of the record.
+     * @note The `DD_TRACE` MACRO should be preferred, as it skips the argument encoding if no trace sink is set.
+     */
+    void writeTrace(const TraceFormat &format, const TraceArguments &arguments) const;
+
     /**
      * @brief Write the string to the output (via callback) if the log level is enabled.
      * @param log_level Log level to be checked and (probably) written.
-     * @param value A copy of the string to be written.
+     * @param value String to be written. It is copied only if it has to outlive the call (asynchronous mode).
      * @examples
      * Logger::get().write(Logger::LogLevel::Info, "Hello World!");
      * @examples_end
      */
-    void write(LogLevel log_level, std::string value) const;
+    void write(LogLevel log_level, std::string_view value) const;
+
+    /**
+     * @brief Write the string to the output (via callback) if the log level is enabled for the category.
+     * @param category Category of the record.
+     * @param log_level Log level to be checked and (probably) written.
+     * @param value String to be written. It is copied only if it has to outlive the call (asynchronous mode).
+     * @examples
+     * Logger::get().write(Logger::LogCategory::scheduler, Logger::LogLevel::info, "Hello World!");
+     * @examples_end
+     */
+    void write(LogCategory category, LogLevel log_level, std::string_view value) const;
+
+    /**
+     * @brief Write the structured record if the log level is enabled for the category.
+     *
+     * The record callback receives the fields as typed values. Otherwise, the fields are
+     * appended to the message as `key=value` pairs.
+     *
+     * @param category Category of the record.
+     * @param log_level Log level to be checked and (probably) written.
+     * @param message Message of the record.
+     * @param fields Key/value pairs of the record.
+     * @note The `DD_LOG_FIELDS` MACRO should be preferred, as it skips the field construction for disabled levels.
+     * @examples
+     * Logger::get().writeFields(Logger::LogCategory::scheduler, Logger::LogLevel::info, "Retrying", {{"attempt", 2}, {"delay_ms", 100}});
+     * @examples_end
+     */
+    void writeFields(LogCategory category, LogLevel log_level, std::string_view message, std::initializer_list<Field> fields) const;
+
+    /**
+     * @brief Format the arguments and write the result to the output (via callback) if the log level is enabled.
+     *
+     * The string is formatted into a buffer that is reused by the calling thread, so that
+     * no heap allocation is needed once the buffer has grown large enough.
+     *
+     * @param log_level Log level to be checked and (probably) written.
+     * @param format Format string for `std::format`.
+     * @param args Arguments to be formatted.
+     * @note The `DD_LOGF` MACRO should be preferred, as it skips the argument evaluation for disabled levels.
+     * @examples
+     * Logger::get().writeFormatted(Logger::LogLevel::Info, "Hello {}!", "World");
+     * @examples_end
+     */
+    template<class... Args>
+    void writeFormatted(const LogLevel log_level, std::format_string<Args...> format, Args &&...args) const {
+      writeFormatted(LogCategory::general, log_level, format, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Format the arguments and write the result to the output (via callback) if the log level is enabled for the category.
+     * @param category Category of the record.
+     * @param log_level Log level to be checked and (probably) written.
+     * @param format Format string for `std::format`.
+     * @param args Arguments to be formatted.
+     * @note The `DD_LOGF_CAT` MACRO should be preferred, as it skips the argument evaluation for disabled levels.
+     * @examples
+     * Logger::get().writeFormatted(Logger::LogCategory::scheduler, Logger::LogLevel::info, "Hello {}!", "World");
+     * @examples_end
+     */
+    template<class... Args>
+    void writeFormatted(const LogCategory category, const LogLevel log_level, std::format_string<Args...> format, Args &&...args) const {
+      if (!isLogLevelEnabled(category, log_level)) {
+        return;
+      }
+
+      const auto lease {detail::acquireFormatBuffer()};
+      auto &buffer {lease.get()};
+      buffer.clear();
+      std::format_to(std::back_inserter(buffer), format, std::forward<Args>(args)...);
+      write(category, log_level, buffer);
+    }
+
+    /**
+     * @brief Switch to the asynchronous mode where the records are queued and written by a background thread.
+     *
+     * The records are pushed into a lock-free ring buffer, so the logging thread never waits
+     * for the formatting or the output (unless the queue is full and `AsyncFullPolicy::Block` is used).
+     * The `fatal` records are never dropped and are written out before `write` returns.
+     *
+     * @param options Configuration for the asynchronous mode.
+     * @note If the mode is already enabled, the records pending in the previous queue are written out before the call returns.
+     *       Records of the threads that are still waiting for free space in it are written out once queued.
+     * @note Safe to be called concurrently with the logging itself.
+     * @examples
+     * Logger::get().enableAsyncMode({ .m_capacity = 4096, .m_full_policy = Logger::AsyncFullPolicy::Block });
+     * @examples_end
+     */
+    void enableAsyncMode(const AsyncOptions &options);
+
+    /**
+     * @brief Write out the pending records, stop the background thread and switch back to the synchronous mode.
+     * @note Safe to be called concurrently with the logging itself.
+     * @examples
+     * Logger::get().disableAsyncMode();
+     * @examples_end
+     */
+    void disableAsyncMode();
+
+    /**
+     * @brief Wait until all of the records queued so far are written out.
+     * @note Also writes out the pending deduplication summary and delivers the pending batched records (if any).
+     * @note Should be called on the shutdown paths when the batch callback is used.
+     * @examples
+     * Logger::get().flush();
+     * @examples_end
+     */
+    void flush() const;
+
+    /**
+     * @brief Collapse identical consecutive records into a single "repeated N time(s)" record.
+     *
+     * A record is identical if its category, level, message and fields match the previous one.
+     * The repeated records are suppressed and summarized once a different record arrives,
+     * once the summary interval elapses or once `flush` is called.
+     *
+     * @param summary_interval How often the summary is written while the same record keeps repeating.
+     * @examples
+     * Logger::get().enableDeduplication(std::chrono::minutes{5});
+     * @examples_end
+     */
+    void enableDeduplication(std::chrono::milliseconds summary_interval = std::chrono::minutes {1});
+
+    /**
+     * @brief Write out the pending summary (if any) and stop collapsing the identical records.
+     * @examples
+     * Logger::get().disableDeduplication();
+     * @examples_end
+     */
+    void disableDeduplication();
+
+    /**
+     * @brief Get the number of records dropped in the asynchronous mode due to the full queue.
+     * @returns Number of dropped records since the asynchronous mode was last enabled.
+     * @examples
+     * const auto dropped { Logger::get().getDroppedCount() };
+     * @examples_end
+     */
+    [[nodiscard]] std::uint64_t getDroppedCount() const;
 
     /**
      * @brief A deleted copy constructor for singleton pattern.
@@ -101,13 +559,186 @@ namespace display_device {
     void operator=(Logger const &) = delete;
 
   private:
+    class AsyncWorker;
+    class Batcher;
+    class Deduplicator;
+
     /**
      * @brief A private constructor to ensure the singleton pattern.
      */
     explicit Logger();
 
-    LogLevel m_enabled_log_level {LogLevel::info}; /**< The currently enabled log level. */
-    Callback m_custom_callback; /**< Custom callback to pass log data to. */
+    /**
+     * @brief A destructor that writes out the pending asynchronous records.
+     */
+    ~Logger();
+
+    /**
+     * @brief Time at which the record was created.
+     */
+    struct Timestamp {
+      TimestampFormat m_format;  ///< Format that determined the clock.
+      std::chrono::nanoseconds m_since_epoch;  ///< Time since the epoch of the clock.
+    };
+
+    /**
+     * @brief Get the current time for the currently enabled timestamp format.
+     */
+    [[nodiscard]] Timestamp now() const;
+
+    /**
+     * @brief Callbacks that the records are passed to.
+     */
+    struct Sinks {
+      Callback m_callback;  ///< Custom callback to pass log data to.
+      RecordCallback m_record_callback;  ///< Custom callback to pass the structured records to.
+      std::shared_ptr<Batcher> m_batcher;  ///< Collects the records for the batch callback.
+      std::shared_ptr<TraceSink> m_trace_sink;  ///< Sink to capture the trace records.
+      std::shared_ptr<AsyncWorker> m_async_worker;  ///< Background writer, only set in the asynchronous mode.
+    };
+
+    /**
+     * @brief Replace the sinks with an updated copy and destroy the previous ones once they are no longer used.
+     * @param update Function modifying the copy.
+     */
+    void updateSinks(const std::function<void(Sinks &)> &update);
+
+    /**
+     * @brief Write the record if the log level is enabled for the category, either directly or via the asynchronous queue.
+     */
+    void writeChecked(LogCategory category, LogLevel log_level, std::string_view message, std::span<const Field> fields) const;
+
+    /**
+     * @brief Deduplicate the record (if enabled) and deliver it.
+     * @param category Category of the record.
+     * @param log_level Log level of the record.
+     * @param timestamp Time at which the record was created.
+     * @param message String to be written.
+     * @param fields Structured fields of the record.
+     * @param flush_output Whether the standard output is to be flushed right away.
+     */
+    void writeRecord(LogCategory category, LogLevel log_level, Timestamp timestamp, std::string_view message, std::span<const Field> fields, bool flush_output) const;
+
+    /**
+     * @brief Deliver the pending deduplication summary (if any).
+     */
+    void writeDeduplicationSummary() const;
+
+    /**
+     * @brief Pass the record to the custom callbacks or write it to the standard output.
+     * @param category Category of the record.
+     * @param log_level Log level of the record.
+     * @param timestamp Time at which the record was created.
+     * @param message String to be written.
+     * @param fields Structured fields of the record.
+     * @param flush_output Whether the standard output is to be flushed right away.
+     */
+    void deliverRecord(LogCategory category, LogLevel log_level, Timestamp timestamp, std::string_view message, std::span<const Field> fields, bool flush_output) const;
+
+    std::atomic<LogLevel> m_enabled_log_level {LogLevel::info}; /**< The currently enabled log level. */
+    std::array<std::atomic<int>, m_category_count> m_category_log_levels {}; /**< Log levels of the categories, negative if the global one is used. */
+    std::atomic<TimestampFormat> m_timestamp_format {TimestampFormat::LocalTime}; /**< The currently used timestamp format. */
+    std::atomic<const Sinks *> m_sinks {nullptr}; /**< Callbacks to pass log data to (owned, replaced via read-copy-update). */
+    mutable std::array<std::atomic<std::uint64_t>, 2> m_sink_readers {}; /**< Number of the sink readers per epoch parity. */
+    std::atomic<std::uint64_t> m_sink_epoch {0}; /**< Epoch that the new sink readers register in. */
+    std::mutex m_sink_mutex {}; /**< Serializes the sink replacements. */
+    std::atomic_bool m_trace_enabled {false}; /**< Whether the trace sink is set. */
+    std::atomic_bool m_deduplicate {false}; /**< Whether the identical consecutive records are collapsed. */
+    std::unique_ptr<Deduplicator> m_deduplicator; /**< State of the deduplication. */
+  };
+
+  /**
+   * @brief Per call site state for the `DD_LOG_EVERY_N` MACRO.
+   */
+  class LogEveryN {
+  public:
+    /**
+     * @brief Check whether the current occurrence is to be logged.
+     * @param n Only every n-th occurrence (starting with the first one) is logged.
+     * @returns True if the occurrence is to be logged.
+     */
+    bool shouldLog(std::uint64_t n);
+
+  private:
+    std::atomic<std::uint64_t> m_counter {0}; /**< Number of the occurrences so far. */
+  };
+
+  /**
+   * @brief Per call site state for the `DD_LOG_ONCE_PER` MACRO.
+   */
+  class LogOncePer {
+  public:
+    /**
+     * @brief Check whether the current occurrence is to be logged.
+     * @param interval Minimum time between the logged occurrences.
+     * @returns True if the occurrence is to be logged.
+     */
+    bool shouldLog(std::chrono::steady_clock::duration interval);
+
+  private:
+    std::atomic<std::chrono::steady_clock::rep> m_next_allowed {std::numeric_limits<std::chrono::steady_clock::rep>::min()}; /**< Earliest time for the next logged occurrence. */
+  };
+
+  /**
+   * @brief Per owner state for the `DD_LOG_LIMITED` MACRO.
+   *
+   * Each distinct message is written at most once per interval. The repeats within the interval are
+   * suppressed and their number is written once the interval has elapsed or the limiter is destroyed.
+   */
+  class LogRepeatLimiter {
+  public:
+    /**
+     * @brief Default constructor for the class.
+     * @param interval Minimum time between the identical records.
+     */
+    explicit LogRepeatLimiter(std::chrono::steady_clock::duration interval = std::chrono::minutes {1});
+
+    /**
+     * @brief Write out the number of the pending suppressed repeats.
+     */
+    ~LogRepeatLimiter() noexcept;
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    LogRepeatLimiter(const LogRepeatLimiter &) = delete;
+
+    /**
+     * @brief Deleted copy assignment operator.
+     */
+    LogRepeatLimiter &operator=(const LogRepeatLimiter &) = delete;
+
+    /**
+     * @brief Check whether the record is to be written.
+     * @param category Category of the record.
+     * @param log_level Log level of the record.
+     * @param message Message of the record.
+     * @returns True if the record is to be written, false if it repeats a message within its interval.
+     * @note The suppressed repeats of the messages whose interval has elapsed are written out first.
+     */
+    bool shouldLog(Logger::LogCategory category, Logger::LogLevel log_level, std::string_view message);
+
+  private:
+    /**
+     * @brief State of a message that has been written.
+     */
+    struct Entry {
+      Logger::LogCategory m_category;  ///< Category of the message.
+      Logger::LogLevel m_log_level;  ///< Log level of the message.
+      std::chrono::steady_clock::time_point m_interval_end;  ///< Time until which the repeats are suppressed.
+      std::uint64_t m_suppressed;  ///< Number of the suppressed repeats.
+    };
+
+    /**
+     * @brief Write out the number of the suppressed repeats of the message.
+     * @param message Message whose repeats were suppressed.
+     * @param entry State of the message.
+     */
+    static void writeSummary(std::string_view message, const Entry &entry);
+
+    std::chrono::steady_clock::duration m_interval; /**< Minimum time between the identical records. */
+    std::mutex m_mutex {}; /**< Serializes the checks. */
+    std::map<std::string, Entry, std::less<>> m_entries {}; /**< Messages that have been written within their interval. */
   };
 
   /**
@@ -121,6 +752,21 @@ namespace display_device {
      */
     explicit LogWriter(Logger::LogLevel log_level);
 
+    /**
+     * @brief Constructor scoped writer utility for the category.
+     * @param category Category to be used when writing out the output.
+     * @param log_level Level to be used when writing out the output.
+     */
+    LogWriter(Logger::LogCategory category, Logger::LogLevel log_level);
+
+    /**
+     * @brief Constructor scoped writer utility that lets the limiter suppress the repeated output.
+     * @param category Category to be used when writing out the output.
+     * @param log_level Level to be used when writing out the output.
+     * @param limiter Limiter to be consulted before writing out the output.
+     */
+    LogWriter(Logger::LogCategory category, Logger::LogLevel log_level, LogRepeatLimiter &limiter);
+
     /**
      * @brief Write out the accumulated output.
      */
@@ -138,18 +784,143 @@ namespace display_device {
     }
 
   private:
+    Logger::LogCategory m_category; /**< Category to be used. */
     Logger::LogLevel m_log_level; /**< Log level to be used. */
+    LogRepeatLimiter *m_limiter {nullptr}; /**< Limiter to be consulted, if any. */
     std::ostringstream m_buffer; /**< Buffer to hold all the output. */
   };
 }  // namespace display_device
 
 /**
  * @brief Helper MACRO that disables output string computation if log level is not enabled.
+ * @note Statements below the `DD_LOG_MIN_LEVEL` are compiled out.
  * @examples
  * DD_LOG(info) << "Hello World!" << " " << 123;
  * DD_LOG(error) << "OH MY GAWD!";
  * @examples_end
  */
-#define DD_LOG(level) \
-  for (bool is_enabled {display_device::Logger::get().isLogLevelEnabled(display_device::Logger::LogLevel::level)}; is_enabled; is_enabled = false) \
-  display_device::LogWriter(display_device::Logger::LogLevel::level)
+#define DD_LOG(level) DD_LOG_CAT(general, level)
+
+/**
+ * @brief Helper MACRO for the `std::format` style logging that disables argument evaluation if log level is not enabled.
+ * @note Statements below the `DD_LOG_MIN_LEVEL` are compiled out.
+ * @examples
+ * DD_LOGF(info, "Hello {}! {}", "World", 123);
+ * DD_LOGF(error, "OH MY GAWD!");
+ * @examples_end
+ */
+#define DD_LOGF(level, ...) DD_LOGF_CAT(general, level, __VA_ARGS__)
+
+/**
+ * @brief Helper MACRO for logging in a category that disables output string computation if log level is not enabled for it.
+ * @note Statements below the `DD_LOG_MIN_LEVEL` are compiled out.
+ * @examples
+ * DD_LOG_CAT(scheduler, debug) << "Hello World!" << " " << 123;
+ * @examples_end
+ */
+#define DD_LOG_CAT(category, level) \
+  if constexpr (static_cast<int>(display_device::Logger::LogLevel::level) < DD_LOG_MIN_LEVEL) { \
+  } else \
+    for (bool is_enabled {display_device::Logger::get().isLogLevelEnabled(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level)}; is_enabled; is_enabled = false) \
+    display_device::LogWriter(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level)
+
+/**
+ * @brief Helper MACRO for the `std::format` style logging in a category.
+ * @note Statements below the `DD_LOG_MIN_LEVEL` are compiled out.
+ * @examples
+ * DD_LOGF_CAT(scheduler, debug, "Hello {}! {}", "World", 123);
+ * @examples_end
+ */
+#define DD_LOGF_CAT(category, level, ...) \
+  do { \
+    if constexpr (static_cast<int>(display_device::Logger::LogLevel::level) >= DD_LOG_MIN_LEVEL) { \
+      if (display_device::Logger::get().isLogLevelEnabled(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level)) { \
+        display_device::Logger::get().writeFormatted(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level, __VA_ARGS__); \
+      } \
+    } \
+  } while (false)
+
+/**
+ * @brief Helper MACRO for writing a structured record with key/value fields.
+ * @note Statements below the `DD_LOG_MIN_LEVEL` are compiled out.
+ * @examples
+ * DD_LOG_FIELDS(scheduler, info, "Retrying", {"attempt", 2}, {"delay_ms", 100}, {"device_id", device_id});
+ * @examples_end
+ */
+#define DD_LOG_FIELDS(category, level, message, ...) \
+  do { \
+    if constexpr (static_cast<int>(display_device::Logger::LogLevel::level) >= DD_LOG_MIN_LEVEL) { \
+      if (display_device::Logger::get().isLogLevelEnabled(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level)) { \
+        display_device::Logger::get().writeFields(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level, message, {__VA_ARGS__}); \
+      } \
+    } \
+  } while (false)
+
+/**
+ * @brief Helper MACRO for logging in a category only every n-th time the statement is reached with the level enabled.
+ * @note Statements below the `DD_LOG_MIN_LEVEL` are compiled out.
+ * @examples
+ * DD_LOG_CAT_EVERY_N(scheduler, error, 100) << "Still failing!";
+ * @examples_end
+ */
+#define DD_LOG_CAT_EVERY_N(category, level, n) \
+  if constexpr (static_cast<int>(display_device::Logger::LogLevel::level) < DD_LOG_MIN_LEVEL) { \
+  } else \
+    for (bool is_enabled {display_device::Logger::get().isLogLevelEnabled(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level) && \
+                          []() -> display_device::LogEveryN & { static display_device::LogEveryN state; return state; }().shouldLog(n)}; \
+         is_enabled; \
+         is_enabled = false) \
+    display_device::LogWriter(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level)
+
+/**
+ * @brief Helper MACRO for logging only every n-th time the statement is reached with the level enabled.
+ * @examples
+ * DD_LOG_EVERY_N(error, 100) << "Still failing!";
+ * @examples_end
+ */
+#define DD_LOG_EVERY_N(level, n) DD_LOG_CAT_EVERY_N(general, level, n)
+
+/**
+ * @brief Helper MACRO for logging in a category at most once per time interval.
+ * @note Statements below the `DD_LOG_MIN_LEVEL` are compiled out.
+ * @examples
+ * DD_LOG_CAT_ONCE_PER(scheduler, error, std::chrono::minutes{1}) << "Still failing!";
+ * @examples_end
+ */
+#define DD_LOG_CAT_ONCE_PER(category, level, interval) \
+  if constexpr (static_cast<int>(display_device::Logger::LogLevel::level) < DD_LOG_MIN_LEVEL) { \
+  } else \
+    for (bool is_enabled {display_device::Logger::get().isLogLevelEnabled(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level) && \
+                          []() -> display_device::LogOncePer & { static display_device::LogOncePer state; return state; }().shouldLog(interval)}; \
+         is_enabled; \
+         is_enabled = false) \
+    display_device::LogWriter(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level)
+
+/**
+ * @brief Helper MACRO for logging at most once per time interval.
+ * @examples
+ * DD_LOG_ONCE_PER(error, std::chrono::minutes{1}) << "Still failing!";
+ * @examples_end
+ */
+#define DD_LOG_ONCE_PER(level, interval) DD_LOG_CAT_ONCE_PER(general, level, interval)
+
+/**
+ * @brief Helper MACRO for logging in a category with the repeats of the same message suppressed by the limiter.
+ * @note Statements below the `DD_LOG_MIN_LEVEL` are compiled out.
+ * @examples
+ * DD_LOG_CAT_LIMITED(scheduler, error, m_log_limiter) << "Still failing!";
+ * @examples_end
+ */
+#define DD_LOG_CAT_LIMITED(category, level, limiter) \
+  if constexpr (static_cast<int>(display_device::Logger::LogLevel::level) < DD_LOG_MIN_LEVEL) { \
+  } else \
+    for (bool is_enabled {display_device::Logger::get().isLogLevelEnabled(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level)}; is_enabled; is_enabled = false) \
+    display_device::LogWriter(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level, limiter)
+
+/**
+ * @brief Helper MACRO for logging with the repeats of the same message suppressed by the limiter.
+ * @examples
+ * DD_LOG_LIMITED(error, m_log_limiter) << "Still failing!";
+ * @examples_end
+ */
+#define DD_LOG_LIMITED(level, limiter) DD_LOG_CAT_LIMITED(general, level, limiter)
@@ -0,0 +1,81 @@
+/**
+ * @file src/common/include/display_device/manual_scheduler_clock.h
+ * @brief Declarations for the ManualSchedulerClock.
+ */
+#pragma once
+
+// system includes
+#include <vector>
+
+// local includes
+#include "scheduler_clock_interface.h"
+
+namespace display_device {
+  /**
+   * @brief Virtual time implementation for SchedulerClockInterface.
+   *
+   * The time only moves when it is advanced manually or when someone sleeps
+   * (sleeping simply advances the time), which makes the retry schedules testable
+   * without spending real time.
+   *
+   * @note The clock must outlive all of the executors using it and must not be advanced
+   *       concurrently with the destruction of such executor.
+   * @examples
+   * const auto clock {std::make_shared<ManualSchedulerClock>()};
+   * RetryScheduler<SettingsManagerInterface> scheduler {getIface(...), std::make_shared<SchedulerExecutor>(0, clock)};
+   *
+   * scheduler.schedule(..., { .m_sleep_durations = { 1h } });
+   * clock->advance(1h);  // The scheduled function is invoked right away
+   * @examples_end
+   */
+  class ManualSchedulerClock: public SchedulerClockInterface {
+  public:
+    /**
+     * @brief Default constructor.
+     * @param start Initial time.
+     */
+    explicit ManualSchedulerClock(TimePoint start = TimePoint {});
+
+    /**
+     * @copydoc SchedulerClockInterface::now
+     */
+    [[nodiscard]] TimePoint now() const override;
+
+    /**
+     * @brief Advance the time to the time point instead of sleeping.
+     * @param time_point Time point to sleep until.
+     */
+    void sleepUntil(TimePoint time_point) override;
+
+    /**
+     * @brief Wait for the condition variable to be notified or for the virtual time to be advanced past the time point.
+     * @copydetails SchedulerClockInterface::waitUntil
+     */
+    void waitUntil(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, TimePoint time_point) override;
+
+    /**
+     * @brief Move the time forward and wake up the waiting threads.
+     * @param duration Duration to advance the time by.
+     */
+    void advance(std::chrono::nanoseconds duration);
+
+    /**
+     * @brief Move the time forward to the time point and wake up the waiting threads.
+     * @param time_point New time. If it is in the past, the time is not changed.
+     */
+    void advanceTo(TimePoint time_point);
+
+  private:
+    /**
+     * @brief A thread waiting inside the `waitUntil` method.
+     */
+    struct Waiter {
+      std::condition_variable *m_cv;  ///< Condition variable to notify.
+      std::mutex *m_mutex;  ///< Mutex guarding the wait, locked while notifying to avoid lost wake-ups.
+    };
+
+    TimePoint m_now;  ///< Current virtual time.
+    std::vector<Waiter> m_waiters;  ///< Threads to be woken up once the time moves.
+    mutable std::mutex m_mutex {};  ///< A mutex for synchronizing the time and the waiters.
+  };
+}  // namespace display_device
@@ -0,0 +1,124 @@
+/**
+ * @file src/common/include/display_device/mpsc_ring_buffer.h
+ * @brief Declarations for the MpscRingBuffer.
+ */
+#pragma once
+
+// system includes
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace display_device {
+  /**
+   * @brief A bounded lock-free queue for many producers and a single consumer.
+   *
+   * Every slot carries a sequence number that tells whether the slot is free for the producer
+   * with the matching ticket or holds a value for the consumer (Vyukov's bounded queue).
+   * Producers only contend on a single atomic counter and never block each other.
+   *
+   * @tparam T Value type, must be default constructible and movable.
+   * @note Only one thread may call `tryPop` at a time.
+   * @examples
+   * MpscRingBuffer<std::string> buffer {1024};
+   * buffer.tryPush("Hello World!");
+   * const auto value {buffer.tryPop()};
+   * @examples_end
+   */
+  template<class T>
+  class MpscRingBuffer final {
+  public:
+    /**
+     * @brief Default constructor.
+     * @param capacity Maximum number of the queued values. Must be a power of 2 larger than 1.
+     */
+    explicit MpscRingBuffer(const std::size_t capacity):
+        m_slots {makeSlots(capacity)},
+        m_mask {capacity - 1} {
+      for (std::size_t i {0}; i < capacity; ++i) {
+        m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    /**
+     * @brief Try to push the value to the back of the queue.
+     * @param value Value to be pushed. It is left untouched if the queue is full.
+     * @returns True if the value was pushed, false if the queue is full.
+     */
+    bool tryPush(T &&value) {
+      auto position {m_enqueue_position.load(std::memory_order_relaxed)};
+      Slot *slot {nullptr};
+      while (true) {
+        slot = &m_slots[position & m_mask];
+        const auto sequence {slot->m_sequence.load(std::memory_order_acquire)};
+        const auto difference {static_cast<std::ptrdiff_t>(sequence - position)};
+        if (difference == 0) {
+          if (m_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+            break;
+          }
+        } else if (difference < 0) {
+          return false;
+        } else {
+          position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+      }
+
+      slot->m_value = std::move(value);
+      slot->m_sequence.store(position + 1, std::memory_order_release);
+      return true;
+    }
+
+    /**
+     * @brief Try to pop the value from the front of the queue.
+     * @returns Popped value or empty optional if there is nothing (fully) pushed yet.
+     */
+    std::optional<T> tryPop() {
+      auto &slot {m_slots[m_dequeue_position & m_mask]};
+      if (slot.m_sequence.load(std::memory_order_acquire) != m_dequeue_position + 1) {
+        return std::nullopt;
+      }
+
+      std::optional<T> value {std::move(slot.m_value)};
+      slot.m_value = T {};
+      slot.m_sequence.store(m_dequeue_position + m_mask + 1, std::memory_order_release);
+      m_dequeue_position++;
+      return value;
+    }
+
+    /**
+     * @brief Get the maximum number of the queued values.
+     * @returns Capacity specified in the constructor.
+     */
+    [[nodiscard]] std::size_t getCapacity() const {
+      return m_mask + 1;
+    }
+
+  private:
+    /**
+     * @brief A single queue cell.
+     */
+    struct Slot {
+      std::atomic<std::size_t> m_sequence {0};  ///< Ticket of the producer (when free) or the consumer (when filled).
+      T m_value {};  ///< Queued value.
+    };
+
+    /**
+     * @brief Allocate the slots if the capacity is valid.
+     */
+    static std::unique_ptr<Slot[]> makeSlots(const std::size_t capacity) {  // NOSONAR(cpp:S5945): Slots are not movable, so a vector cannot be used.
+      if (capacity < 2 || !std::has_single_bit(capacity)) {
+        throw std::invalid_argument {"Capacity specified in MpscRingBuffer must be a power of 2 larger than 1!"};
+      }
+      return std::make_unique<Slot[]>(capacity);  // NOSONAR(cpp:S5945): Slots are not movable, so a vector cannot be used.
+    }
+
+    std::unique_ptr<Slot[]> m_slots; /* NOSONAR(cpp:S5945): Slots are not movable, so a vector cannot be used. */  ///< Queue cells.
+    std::size_t m_mask;  ///< Capacity - 1, used for wrapping the positions.
+    alignas(64) std::atomic<std::size_t> m_enqueue_position {0};  ///< Ticket for the next producer.
+    alignas(64) std::size_t m_dequeue_position {0};  ///< Ticket for the consumer.
+  };
+}  // namespace display_device
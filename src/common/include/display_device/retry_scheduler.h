@@ -6,19 +6,30 @@
 
 // system includes
 #include <algorithm>
-#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
 #include <exception>
 #include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <stdexcept>
+#include <string>
 #include <thread>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 // local includes
+#include "backoff_policy.h"
 #include "logging.h"
+#include "scheduler_executor.h"
+#include "scheduler_metrics.h"
 
 namespace display_device {
   /**
@@ -74,8 +85,8 @@ namespace display_device {
      * @param message Context message to prepend.
      */
     inline void logSchedulerException(const std::exception &exception, const char *message) {
-      DD_LOG(error) << message << " Error:\n"
-                    << exception.what();
+      DD_LOG_CAT(scheduler, error) << message << " Error:\n"
+                                   << exception.what();
     }
 
     /**
@@ -148,8 +159,37 @@ namespace display_device {
      */
     template<class T, class FunctionT>
     concept ExecuteCallbackLike = ExecuteWithoutStopToken<T, FunctionT> || ExecuteWithStopToken<T, FunctionT>;
+
+    /**
+     * @brief Check if the mutex supports shared ownership (like std::shared_mutex).
+     */
+    template<class MutexT>
+    concept SharedLockable = requires(MutexT &mutex) {
+      mutex.lock_shared();
+      mutex.unlock_shared();
+    };
   }  // namespace detail
 
+  /**
+   * @brief Reason why the scheduled function has finished.
+   */
+  enum class SchedulerOutcome {
+    Success,  ///< The function has requested to stop via its stop token.
+    Cancelled,  ///< The function was cancelled, replaced or stopped from the outside (including the scheduler's destruction).
+    TimedOut,  ///< The next retry would have exceeded `SchedulerOptions::m_deadline`.
+    AttemptsExhausted,  ///< The function was invoked `SchedulerOptions::m_max_attempts` times.
+    Exception  ///< The function has thrown an exception.
+  };
+
+  /**
+   * @brief Summary of the finished scheduled function.
+   */
+  struct SchedulerCompletion {
+    SchedulerOutcome m_outcome;  ///< Reason why the function has finished.
+    std::size_t m_attempts;  ///< Number of times the function was invoked.
+    std::exception_ptr m_exception {};  ///< Exception thrown by the function if the outcome is `SchedulerOutcome::Exception`.
+  };
+
   /**
    * @brief Scheduler options to be used when scheduling executor function.
    */
@@ -159,46 +199,95 @@ namespace display_device {
      */
     enum class Execution {
       Immediate,  ///< Executor is executed in the calling thread immediately and scheduled afterward.
-      ImmediateWithSleep,  ///< The first sleep duration is TAKEN from `m_sleep_durations` and the calling thread is put to sleep. Once awoken, follows by same logic as `Immediate`.
+      ImmediateWithSleep,  ///< The first sleep duration is TAKEN from `m_sleep_durations` (or `m_backoff`) and the calling thread is put to sleep. Once awoken, follows by same logic as `Immediate`.
       ScheduledOnly  ///< Executor is executed in the thread only.
     };
 
-    std::vector<std::chrono::milliseconds> m_sleep_durations;  ///< Specifies for long the scheduled thread sleeps before invoking executor. Last duration is reused indefinitely.
+    std::vector<std::chrono::milliseconds> m_sleep_durations {};  ///< Specifies for long the scheduled thread sleeps before invoking executor. Last duration is reused indefinitely.
     Execution m_execution {Execution::Immediate};  ///< Executor's execution logic.
+    std::optional<AnyBackoffPolicy> m_backoff {};  ///< Policy computing the sleep durations instead of `m_sleep_durations` (which must be empty then).
+    std::optional<std::size_t> m_max_attempts {};  ///< Maximum number of executor invocations (including the immediate one) before the scheduler gives up.
+    std::optional<std::chrono::milliseconds> m_deadline {};  ///< Time, measured from the schedule call, after which no more retries are started.
+    std::function<void(const SchedulerCompletion &)> m_on_completion {};  ///< Invoked exactly once when the function has finished for any reason. It is called once the scheduler's lock is released, in the thread that has finished the function (the executor's thread or the caller of the method that has stopped it). `isScheduled` can become false before it is invoked.
   };
 
+  /**
+   * @brief A handle identifying a job scheduled via RetryScheduler::scheduleJob.
+   */
+  using SchedulerJobId = std::uint64_t;
+
   /**
    * @brief A wrapper class around an interface that provides a thread-safe access to the
    *        interface and allows to schedule arbitrary logic for it to retry until it succeeds.
-   * @note The scheduler is designed to only schedule 1 callback at a time, until it is either
-   *       replaced or stopped.
+   * @note The `schedule` method manages a single callback at a time, until it is either
+   *       replaced or stopped. Additional independent callbacks can be added via `scheduleJob`.
+   * @note The scheduled callbacks are invoked by the SchedulerExecutor, which can either be
+   *       private to the scheduler or shared between many schedulers.
+   * @tparam T Interface type.
+   * @tparam MutexT Mutex type guarding the interface. If it supports shared ownership (like `std::shared_mutex`),
+   *                the const `execute` calls are allowed to run concurrently with each other, while the
+   *                non-const calls and the scheduled callbacks remain exclusive. This requires the const
+   *                methods of the interface to be safe for concurrent use, hence it is opt-in.
+   * @examples
+   * // Read-only queries from several threads are not serialized with each other
+   * RetryScheduler<SettingsManagerInterface, std::shared_mutex> scheduler{getIface(...)};
+   * @examples_end
    */
-  template<class T>
+  template<class T, class MutexT = std::mutex>
   class RetryScheduler final {
   public:
     /**
      * @brief Default constructor.
      * @param iface Interface to be passed around to the executor functions.
+     * @param executor [Optional] Executor shared with other schedulers. If not provided,
+     *                 a private executor with a single thread (and no workers) is created.
+     * @param metrics [Optional] Metrics to record the scheduler's telemetry into. Can be shared with other schedulers.
+     * @examples
+     * const auto executor {std::make_shared<SchedulerExecutor>()};
+     * RetryScheduler<SettingsManagerInterface> scheduler_a {getIface(...), executor};
+     * RetryScheduler<SettingsManagerInterface> scheduler_b {getIface(...), executor};
+     * @examples_end
      */
-    explicit RetryScheduler(std::unique_ptr<T> iface):
+    explicit RetryScheduler(std::unique_ptr<T> iface, std::shared_ptr<SchedulerExecutor> executor = nullptr, std::shared_ptr<SchedulerMetrics> metrics = nullptr):
         m_iface {iface ? std::move(iface) : throw std::invalid_argument {"Nullptr interface provided in RetryScheduler!"}},
-        m_thread {[this]() {
-          runThreadLoop();
-        }} {
+        m_metrics {std::move(metrics)},
+        m_executor {executor ? std::move(executor) : std::make_shared<SchedulerExecutor>(0)},
+        m_client_id {m_executor->addClient([this]() {
+          runScheduledRetry();
+        })} {
     }
 
     /**
-     * @brief A destructor that gracefully shuts down the thread.
+     * @brief Deleted copy constructor.
+     */
+    RetryScheduler(const RetryScheduler &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    RetryScheduler &operator=(const RetryScheduler &) = delete;
+
+    /**
+     * @brief A destructor that detaches the scheduler from the executor.
      */
     ~RetryScheduler() {
+      std::vector<AsyncTask> abandoned_tasks;
       {
-        std::lock_guard lock {m_mutex};
-        m_keep_alive = false;
-        syncThreadUnlocked();
+        const CompletingLock lock {*this};
+        clearThreadLoopUnlocked();
+
+        std::lock_guard async_lock {m_async_mutex};
+        abandoned_tasks.swap(m_async_tasks);
       }
 
-      if (m_thread.joinable()) {
-        m_thread.join();
+      // Blocks until the callback is no longer running in the executor.
+      m_executor->removeClient(m_client_id);
+
+      // Awaiting coroutines are resumed with an exception instead of being left suspended forever.
+      for (const auto &task : abandoned_tasks) {
+        if (task.m_abandon) {
+          task.m_abandon();
+        }
       }
     }
 
@@ -208,7 +297,7 @@ namespace display_device {
      *                It accepts a `stop_token` as a second parameter which can be used to stop
      *                the scheduler.
      * @param options Options for the scheduler.
-     * @note Previously scheduled executor is replaced by a new one!
+     * @note Previously scheduled executor is replaced by a new one! Jobs added via `scheduleJob` are not affected.
      * @examples
      * std::unique_ptr<SettingsManagerInterface> iface = getIface(...);
      * RetryScheduler<SettingsManagerInterface> scheduler{std::move(iface)};
@@ -218,49 +307,123 @@ namespace display_device {
      *     stop_token.requestStop();
      *   }
      * }, { .m_sleep_durations = { 50ms, 10ms });
+     *
+     * // Exponential up to 5s with ±20% jitter, giving up after a minute:
+     * scheduler.schedule([](SettingsManagerInterface& iface, SchedulerStopToken& stop_token){
+     *   if (iface.revertSettings()) {
+     *     stop_token.requestStop();
+     *   }
+     * }, { .m_backoff = ExponentialBackoff { .m_initial_delay = 100ms, .m_max_delay = 5s, .m_jitter = 0.2 }, .m_deadline = 60s });
+     *
+     * // Give up after 30s or 50 attempts and get told the outcome:
+     * auto promise = std::make_shared<std::promise<SchedulerCompletion>>();
+     * auto outcome = promise->get_future();
+     * scheduler.schedule([](SettingsManagerInterface& iface, SchedulerStopToken& stop_token){
+     *   if (iface.revertSettings()) {
+     *     stop_token.requestStop();
+     *   }
+     * }, { .m_sleep_durations = { 500ms }, .m_max_attempts = 50, .m_deadline = 30s, .m_on_completion = [promise](const SchedulerCompletion& completion) {
+     *   promise->set_value(completion);
+     * }});
      * @examples_end
      */
     void schedule(std::function<void(T &, SchedulerStopToken &stop_token)> exec_fn, const SchedulerOptions &options) {
-      if (!exec_fn) {
-        throw std::invalid_argument {"Empty callback function provided in RetryScheduler::schedule!"};
-      }
+      validateScheduleArguments(exec_fn, options, "RetryScheduler::schedule");
 
-      if (options.m_sleep_durations.empty()) {
-        throw std::invalid_argument {"At least 1 sleep duration must be specified in RetryScheduler::schedule!"};
+      const CompletingLock lock {*this};
+      if (m_primary_job_id) {
+        cancelUnlocked(*m_primary_job_id);
       }
 
-      if (std::ranges::any_of(options.m_sleep_durations, [&](const auto &duration) {
-            return duration == std::chrono::milliseconds::zero();
-          })) {
-        throw std::invalid_argument {"All of the durations specified in RetryScheduler::schedule must be larger than a 0!"};
+      const auto job_id {m_next_job_id++};
+      if (scheduleUnlocked(job_id, std::move(exec_fn), options, "Exception thrown in the RetryScheduler::schedule. Stopping scheduler.")) {
+        m_primary_job_id = job_id;
       }
+    }
 
-      std::lock_guard lock {m_mutex};
-      SchedulerStopToken stop_token {[this]() {
-        stopUnlocked();
-      }};
+    /**
+     * @brief Schedule an additional, independent interface executor function.
+     * @param exec_fn Provides thread-safe access to the interface for executing arbitrary logic.
+     *                It accepts a `stop_token` as a second parameter which can be used to stop
+     *                this job only.
+     * @param options Options for this job.
+     * @returns Handle of the job that can be used to cancel it. The handle is returned even if
+     *          the job has stopped during the immediate execution.
+     * @note Unlike `schedule`, the previously scheduled jobs are NOT replaced.
+     * @examples
+     * std::unique_ptr<SettingsManagerInterface> iface = getIface(...);
+     * RetryScheduler<SettingsManagerInterface> scheduler{std::move(iface)};
+     *
+     * const auto revert_job = scheduler.scheduleJob([](SettingsManagerInterface& iface, SchedulerStopToken& stop_token){
+     *   if (iface.revertSettings()) {
+     *     stop_token.requestStop();
+     *   }
+     * }, { .m_sleep_durations = { 50ms, 10ms });
+     * const auto probe_job = scheduler.scheduleJob([](SettingsManagerInterface& iface, SchedulerStopToken&){
+     *   iface.enumAvailableDevices();
+     * }, { .m_sleep_durations = { 5000ms }, .m_execution = SchedulerOptions::Execution::ScheduledOnly });
+     *
+     * scheduler.cancel(probe_job);
+     * @examples_end
+     */
+    SchedulerJobId scheduleJob(std::function<void(T &, SchedulerStopToken &stop_token)> exec_fn, const SchedulerOptions &options) {
+      validateScheduleArguments(exec_fn, options, "RetryScheduler::scheduleJob");
 
-      // We are catching the exception here instead of propagating to have
-      // similar try...catch login as in the scheduler thread.
-      try {
-        auto sleep_durations = options.m_sleep_durations;
-        if (options.m_execution != SchedulerOptions::Execution::ScheduledOnly) {
-          if (options.m_execution == SchedulerOptions::Execution::ImmediateWithSleep) {
-            std::this_thread::sleep_for(takeNextDuration(sleep_durations));
-          }
+      const CompletingLock lock {*this};
+      const auto job_id {m_next_job_id++};
+      scheduleUnlocked(job_id, std::move(exec_fn), options, "Exception thrown in the RetryScheduler::scheduleJob. Stopping job.");
+      return job_id;
+    }
 
-          exec_fn(*m_iface, stop_token);
-        }
+    /**
+     * @brief Cancel the job - it will no longer be executed once THIS method returns.
+     * @param job_id Handle of the job returned by `scheduleJob`.
+     * @note Cancelling a job that has already stopped is a no-op.
+     */
+    void cancel(const SchedulerJobId job_id) {
+      const CompletingLock lock {*this};
+      cancelUnlocked(job_id);
+      armExecutorUnlocked();
+    }
 
-        if (!stop_token.stopRequested()) {
-          m_retry_function = std::move(exec_fn);
-          m_sleep_durations = std::move(sleep_durations);
-          syncThreadUnlocked();
-        }
-      } catch (const std::exception &error) {  // NOSONAR(cpp:S1181): Scheduler callback boundary must catch standard callback failures.
-        stop_token.requestStop();
-        detail::logSchedulerException(error, "Exception thrown in the RetryScheduler::schedule. Stopping scheduler.");
-      }
+    /**
+     * @brief Retry all of the scheduled functions as soon as possible, cutting their current sleep short.
+     * @note Does not block and can be called from any thread, including the scheduler callbacks.
+     *       Triggers that arrive while the function is already due are coalesced.
+     * @note The sleep duration sequence is not reset - the next sleep after the triggered retry
+     *       is the same one that would have followed the regular retry.
+     * @examples
+     * std::unique_ptr<SettingsManagerInterface> iface = getIface(...);
+     * RetryScheduler<SettingsManagerInterface> scheduler{std::move(iface)};
+     *
+     * // Retry rarely on its own...
+     * scheduler.schedule([](SettingsManagerInterface& iface, SchedulerStopToken& stop_token){
+     *   if (iface.revertSettings()) {
+     *     stop_token.requestStop();
+     *   }
+     * }, { .m_sleep_durations = { 30min } });
+     *
+     * // ...but right away once something has changed in the system
+     * onDisplayHotplug([&scheduler]() {
+     *   scheduler.trigger();
+     * });
+     * @examples_end
+     */
+    void trigger() {
+      enqueueAsyncTask({.m_run = [this]() {
+        triggerUnlocked(std::nullopt);
+      }});
+    }
+
+    /**
+     * @brief Retry the specific job as soon as possible, cutting its current sleep short.
+     * @param job_id Handle of the job returned by `scheduleJob`.
+     * @note Same as `trigger()`, except that only the specified job is affected.
+     */
+    void trigger(const SchedulerJobId job_id) {
+      enqueueAsyncTask({.m_run = [this, job_id]() {
+        triggerUnlocked(job_id);
+      }});
     }
 
     /**
@@ -285,32 +448,243 @@ namespace display_device {
       return executeImpl(*this, std::forward<FunctionT>(exec_fn));
     }
 
+    /**
+     * @brief A non-const variant of the `executeAsyncImpl` method. See it for details.
+     * @tparam FunctionT Function type.
+     * @param exec_fn Function to execute.
+     * @returns Future for the return value from the function.
+     */
+    template<class FunctionT>
+    auto executeAsync(FunctionT &&exec_fn) {
+      return executeAsyncImpl(*this, std::forward<FunctionT>(exec_fn));
+    }
+
+    /**
+     * @brief A const variant of the `executeAsyncImpl` method. See it for details.
+     * @tparam FunctionT Function type.
+     * @param exec_fn Function to execute.
+     * @returns Future for the return value from the function.
+     */
+    template<class FunctionT>
+    auto executeAsync(FunctionT &&exec_fn) const {
+      return executeAsyncImpl(*this, std::forward<FunctionT>(exec_fn));
+    }
+
+    /**
+     * @brief A non-const variant of the `coExecuteImpl` method. See it for details.
+     * @tparam FunctionT Function type.
+     * @param exec_fn Function to execute.
+     * @returns Awaitable for the return value from the function.
+     */
+    template<class FunctionT>
+    auto coExecute(FunctionT &&exec_fn) {
+      return coExecuteImpl(*this, std::forward<FunctionT>(exec_fn));
+    }
+
+    /**
+     * @brief A const variant of the `coExecuteImpl` method. See it for details.
+     * @tparam FunctionT Function type.
+     * @param exec_fn Function to execute.
+     * @returns Awaitable for the return value from the function.
+     */
+    template<class FunctionT>
+    auto coExecute(FunctionT &&exec_fn) const {
+      return coExecuteImpl(*this, std::forward<FunctionT>(exec_fn));
+    }
+
     /**
      * @brief Check whether anything is scheduled for execution.
      * @return True if something is scheduled, false otherwise.
      */
     [[nodiscard]] bool isScheduled() const {
-      return static_cast<bool>(m_retry_function);
+      return m_job_count > 0;
+    }
+
+    /**
+     * @brief Check whether the specific job is scheduled for execution.
+     * @param job_id Handle of the job returned by `scheduleJob`.
+     * @return True if the job is scheduled, false otherwise.
+     * @note Must not be called from within the scheduler callbacks.
+     */
+    [[nodiscard]] bool isScheduled(const SchedulerJobId job_id) const {
+      const auto lock {lockForAccess(*this)};
+      return m_jobs.contains(job_id);
     }
 
     /**
-     * @brief Stop the scheduled function - will no longer be execute once THIS method returns.
+     * @brief Stop all of the scheduled functions - will no longer be execute once THIS method returns.
      */
     void stop() {
-      std::lock_guard lock {m_mutex};
+      const CompletingLock lock {*this};
       stopUnlocked();
     }
 
   private:
-    static std::chrono::milliseconds takeNextDuration(std::vector<std::chrono::milliseconds> &durations) {
-      if (durations.size() > 1) {
-        const auto front_it {std::begin(durations)};
-        const auto front_value {*front_it};
-        durations.erase(front_it);
-        return front_value;
+    /**
+     * @brief A single scheduled function with its own timing.
+     */
+    struct ScheduledJob {
+      std::function<void(T &, SchedulerStopToken &)> m_function;  ///< Function to be executed until it succeeds.
+      SchedulerOptions m_options;  ///< Options the job was scheduled with.
+      BackoffState m_backoff_state {};  ///< Position in the sleep duration sequence.
+      std::size_t m_attempts {0};  ///< Number of times the function has been executed.
+      SchedulerExecutor::TimePoint m_started_at {};  ///< Time point at which the job was scheduled.
+      SchedulerExecutor::TimePoint m_next_retry_time {};  ///< Time point at which the function is to be executed next.
+    };
+
+    using JobQueueEntry = std::pair<SchedulerExecutor::TimePoint, SchedulerJobId>;
+
+    /**
+     * @brief Task queued via `executeAsync` or `coExecute`.
+     */
+    struct AsyncTask {
+      std::function<void()> m_run;  ///< Executes the task in the scheduler's thread.
+      std::function<void()> m_abandon {};  ///< Invoked (if set) instead of `m_run` when the scheduler is destroyed first.
+    };
+
+    /**
+     * @brief Completion callback waiting to be invoked once the scheduler's lock is released.
+     */
+    struct PendingCompletion {
+      std::function<void(const SchedulerCompletion &)> m_callback;  ///< Callback of the finished job.
+      SchedulerCompletion m_completion;  ///< Summary to invoke the callback with.
+    };
+
+    /**
+     * @brief Exclusive lock of the scheduler that invokes the completion callbacks
+     *        queued while it was held, once it is released.
+     */
+    class CompletingLock {
+    public:
+      explicit CompletingLock(RetryScheduler &self):
+          m_self {self},
+          m_lock {self.m_mutex} {
+      }
+
+      CompletingLock(const CompletingLock &) = delete;
+      CompletingLock &operator=(const CompletingLock &) = delete;
+
+      ~CompletingLock() {
+        auto completions {std::exchange(m_self.m_pending_completions, {})};
+        m_lock.unlock();
+        invokeCompletions(completions);
       }
 
-      return durations.empty() ? std::chrono::milliseconds::zero() : durations.back();
+    private:
+      RetryScheduler &m_self;
+      std::unique_lock<MutexT> m_lock;
+    };
+
+    /**
+     * @brief Throw if the arguments for the schedule methods are invalid.
+     */
+    static void validateScheduleArguments(const std::function<void(T &, SchedulerStopToken &)> &exec_fn, const SchedulerOptions &options, const std::string &method) {
+      if (!exec_fn) {
+        throw std::invalid_argument {"Empty callback function provided in " + method + "!"};
+      }
+
+      if (options.m_backoff) {
+        if (!options.m_sleep_durations.empty()) {
+          throw std::invalid_argument {"Sleep durations and backoff policy cannot be both specified in " + method + "!"};
+        }
+
+        if (!options.m_backoff->isValid()) {
+          throw std::invalid_argument {"Invalid backoff policy specified in " + method + "!"};
+        }
+      } else {
+        if (options.m_sleep_durations.empty()) {
+          throw std::invalid_argument {"At least 1 sleep duration must be specified in " + method + "!"};
+        }
+
+        if (std::ranges::any_of(options.m_sleep_durations, [&](const auto &duration) {
+              return duration == std::chrono::milliseconds::zero();
+            })) {
+          throw std::invalid_argument {"All of the durations specified in " + method + " must be larger than a 0!"};
+        }
+      }
+
+      if (options.m_max_attempts && *options.m_max_attempts == 0) {
+        throw std::invalid_argument {"Max attempts specified in " + method + " must be larger than a 0!"};
+      }
+
+      if (options.m_deadline && *options.m_deadline <= std::chrono::milliseconds::zero()) {
+        throw std::invalid_argument {"Deadline specified in " + method + " must be larger than a 0!"};
+      }
+    }
+
+    /**
+     * @brief Take the next sleep duration from the backoff policy or the duration list.
+     * @note The duration list is traversed via the state's attempt counter, the last duration being reused indefinitely.
+     */
+    static std::chrono::milliseconds takeNextDuration(const SchedulerOptions &options, BackoffState &state) {
+      if (options.m_backoff) {
+        return options.m_backoff->nextDelay(state);
+      }
+
+      const auto &durations {options.m_sleep_durations};
+      const auto duration {durations[std::min(state.m_attempt, durations.size() - 1)]};
+      state.m_attempt++;
+      state.m_previous_delay = duration;
+      return duration;
+    }
+
+    /**
+     * @brief Throw if an empty optional function (like std::function) is provided.
+     */
+    template<class FunctionT>
+    static void validateExecuteCallback(const FunctionT &exec_fn, const std::string &method) {
+      if constexpr (detail::OptionalFunction<FunctionT>) {
+        if (!exec_fn) {
+          throw std::invalid_argument {"Empty callback function provided in " + method + "!"};
+        }
+      }
+    }
+
+    /**
+     * @brief Lock the scheduler for accessing the interface.
+     * @returns Shared lock for the const access if the mutex supports it, exclusive lock otherwise.
+     *          The non-const access can stop the jobs, so its lock invokes their completion callbacks once released.
+     */
+    template<class SelfT>
+    static auto lockForAccess(SelfT &self) {
+      if constexpr (!std::is_const_v<SelfT>) {
+        return CompletingLock {self};
+      } else if constexpr (detail::SharedLockable<MutexT>) {
+        return std::shared_lock {self.m_mutex};
+      } else {
+        return std::unique_lock {self.m_mutex};
+      }
+    }
+
+    /**
+     * @brief Invoke the completion callbacks of the finished jobs.
+     * @note The caller must NOT hold the scheduler's lock.
+     */
+    static void invokeCompletions(const std::vector<PendingCompletion> &completions) {
+      for (const auto &[callback, completion] : completions) {
+        try {
+          callback(completion);
+        } catch (const std::exception &error) {  // NOSONAR(cpp:S1181): Completion callback boundary must catch standard callback failures.
+          detail::logSchedulerException(error, "Exception thrown in the RetryScheduler completion callback. Ignoring.");
+        }
+      }
+    }
+
+    /**
+     * @brief Invoke the callback with the interface (and optional stop token).
+     * @note The caller must hold the scheduler's lock.
+     */
+    template<class SelfT, class FunctionT>
+    static auto invokeUnlocked(SelfT &self, FunctionT &&exec_fn) {
+      constexpr bool IsConst = std::is_const_v<std::remove_reference_t<SelfT>>;
+
+      detail::auto_const_t<std::decay_t<T>, IsConst> &iface_ref {*self.m_iface};
+      if constexpr (detail::ExecuteWithStopToken<T, FunctionT>) {
+        detail::auto_const_t<SchedulerStopToken, IsConst> stop_token {makeStopCallback(self)};
+        return std::forward<FunctionT>(exec_fn)(iface_ref, stop_token);
+      } else {
+        return std::forward<FunctionT>(exec_fn)(iface_ref);
+      }
     }
 
     /**
@@ -352,22 +726,200 @@ namespace display_device {
     template<class SelfT, class FunctionT>
       requires detail::ExecuteCallbackLike<T, FunctionT>
     static auto executeImpl(SelfT &self, FunctionT &&exec_fn) {
-      constexpr bool IsConst = std::is_const_v<std::remove_reference_t<SelfT>>;
+      validateExecuteCallback(exec_fn, "RetryScheduler::execute");
 
-      if constexpr (detail::OptionalFunction<FunctionT>) {
-        if (!exec_fn) {
-          throw std::invalid_argument {"Empty callback function provided in RetryScheduler::execute!"};
+      if (!self.m_metrics) {
+        const auto lock {lockForAccess(self)};
+        return invokeUnlocked(self, std::forward<FunctionT>(exec_fn));
+      }
+
+      const auto wait_start {std::chrono::steady_clock::now()};
+      const auto lock {lockForAccess(self)};
+      self.m_metrics->recordMutexWait(std::chrono::steady_clock::now() - wait_start);
+      return invokeUnlocked(self, std::forward<FunctionT>(exec_fn));
+    }
+
+    /**
+     * @brief Queue arbitrary logic to be executed in the scheduler's thread using the provided interface.
+     * @param self A reference to *this.
+     * @param exec_fn Same as for the `executeImpl` method. The callable is moved (or copied) into
+     *                the queue, therefore it must not capture references that can dangle.
+     * @return Future for the return value from the executor callback. Exceptions thrown by the
+     *         callback are stored in the future. If the scheduler is destroyed before the callback
+     *         is executed, the future will contain `std::future_error` (broken promise).
+     * @note This method is not to be used directly. Intead the `executeAsync` method is to be used.
+     * @note The queued callbacks are executed before the scheduled functions that are due.
+     * @examples
+     * std::unique_ptr<SettingsManagerInterface> iface = getIface(...);
+     * RetryScheduler<SettingsManagerInterface> scheduler{std::move(iface)};
+     *
+     * // Does not block even if the scheduler thread is busy with reverting settings
+     * auto devices_future = scheduler.executeAsync([](SettingsManagerInterface& iface) {
+     *   return iface.enumAvailableDevices();
+     * });
+     *
+     * // ... do something else ...
+     * const auto devices = devices_future.get();
+     * @examples_end
+     */
+    template<class SelfT, class FunctionT>
+      requires detail::ExecuteCallbackLike<T, FunctionT>
+    static auto executeAsyncImpl(SelfT &self, FunctionT &&exec_fn) {
+      validateExecuteCallback(exec_fn, "RetryScheduler::executeAsync");
+
+      using FnT = std::decay_t<FunctionT>;
+      using ResultT = decltype(invokeUnlocked(self, std::declval<FnT &>()));
+
+      auto promise {std::make_shared<std::promise<ResultT>>()};
+      auto future {promise->get_future()};
+      auto shared_fn {std::make_shared<FnT>(std::forward<FunctionT>(exec_fn))};
+
+      // Abandoned task destroys the promise, leaving the future with a broken promise.
+      self.enqueueAsyncTask({.m_run = [&self, promise, shared_fn]() {
+        try {
+          if constexpr (std::is_void_v<ResultT>) {
+            invokeUnlocked(self, *shared_fn);
+            promise->set_value();
+          } else {
+            promise->set_value(invokeUnlocked(self, *shared_fn));
+          }
+        } catch (...) {  // NOSONAR(cpp:S2738): Any exception is forwarded to the caller via the future.
+          promise->set_exception(std::current_exception());
         }
+      }});
+      return future;
+    }
+
+    /**
+     * @brief Create a C++20 awaitable that executes arbitrary logic in the scheduler's thread.
+     * @param self A reference to *this.
+     * @param exec_fn Same as for the `executeImpl` method. The callable is moved (or copied) into the awaitable.
+     * @return Awaitable for the return value from the executor callback. Exceptions thrown by the
+     *         callback are rethrown from the `co_await` expression.
+     * @note This method is not to be used directly. Intead the `coExecute` method is to be used.
+     * @note The awaiting coroutine is resumed in the scheduler's thread (without holding the scheduler's lock).
+     *       If the scheduler is destroyed before the callback is executed, the coroutine is resumed from the
+     *       destructor and the `co_await` expression throws `std::runtime_error`. The scheduler must not be
+     *       used by the coroutine anymore in that case.
+     * @examples
+     * Task<void> refreshDevices(RetryScheduler<SettingsManagerInterface>& scheduler) {
+     *   const auto devices = co_await scheduler.coExecute([](SettingsManagerInterface& iface) {
+     *     return iface.enumAvailableDevices();
+     *   });
+     *   // ...
+     * }
+     * @examples_end
+     */
+    template<class SelfT, class FunctionT>
+      requires detail::ExecuteCallbackLike<T, FunctionT>
+    static auto coExecuteImpl(SelfT &self, FunctionT &&exec_fn) {
+      validateExecuteCallback(exec_fn, "RetryScheduler::coExecute");
+      return ExecuteAwaitable<SelfT, std::decay_t<FunctionT>> {self, std::forward<FunctionT>(exec_fn)};
+    }
+
+    /**
+     * @brief Awaitable returned by the `coExecuteImpl` method.
+     */
+    template<class SelfT, class FnT>
+    class ExecuteAwaitable {
+    public:
+      using ResultT = decltype(invokeUnlocked(std::declval<SelfT &>(), std::declval<FnT &>()));
+
+      ExecuteAwaitable(SelfT &self, FnT exec_fn):
+          m_self {self},
+          m_exec_fn {std::move(exec_fn)} {
       }
 
-      std::lock_guard lock {self.m_mutex};
-      detail::auto_const_t<std::decay_t<T>, IsConst> &iface_ref {*self.m_iface};
-      if constexpr (detail::ExecuteWithStopToken<T, FunctionT>) {
-        detail::auto_const_t<SchedulerStopToken, IsConst> stop_token {makeStopCallback(self)};
-        return std::forward<FunctionT>(exec_fn)(iface_ref, stop_token);
-      } else {
-        return std::forward<FunctionT>(exec_fn)(iface_ref);
+      [[nodiscard]] bool await_ready() const noexcept {
+        return false;
+      }
+
+      void await_suspend(std::coroutine_handle<> handle) {
+        auto run {[this, handle]() {
+          try {
+            if constexpr (std::is_void_v<ResultT>) {
+              invokeUnlocked(m_self, m_exec_fn);
+            } else {
+              m_result.emplace(invokeUnlocked(m_self, m_exec_fn));
+            }
+          } catch (...) {  // NOSONAR(cpp:S2738): Any exception is forwarded to the caller via co_await.
+            m_exception = std::current_exception();
+          }
+
+          // The coroutine must be resumed only once the scheduler's lock is released.
+          m_self.m_resume_handles.push_back(handle);
+        }};
+        auto abandon {[this, handle]() {
+          m_exception = std::make_exception_ptr(std::runtime_error {"RetryScheduler was destroyed before executing the callback in RetryScheduler::coExecute!"});
+          handle.resume();
+        }};
+
+        m_self.enqueueAsyncTask({.m_run = std::move(run), .m_abandon = std::move(abandon)});
+      }
+
+      ResultT await_resume() {
+        if (m_exception) {
+          std::rethrow_exception(m_exception);
+        }
+
+        if constexpr (!std::is_void_v<ResultT>) {
+          return std::move(*m_result);
+        }
+      }
+
+    private:
+      SelfT &m_self;
+      FnT m_exec_fn;
+      std::conditional_t<std::is_void_v<ResultT>, bool, std::optional<ResultT>> m_result {};
+      std::exception_ptr m_exception {};
+    };
+
+    /**
+     * @brief Perform the immediate execution (if requested) and add the job to the queue.
+     * @returns True if the job was added to the queue, false if it has stopped already.
+     */
+    bool scheduleUnlocked(const SchedulerJobId job_id, std::function<void(T &, SchedulerStopToken &)> exec_fn, const SchedulerOptions &options, const char *error_context) {
+      bool stop_requested {false};
+      ScheduledJob job {
+        .m_function = std::move(exec_fn),
+        .m_options = options,
+        .m_started_at = m_executor->getClock().now()
+      };
+      if (m_metrics) {
+        m_metrics->recordSchedule();
       }
+
+      // We are catching the exception here instead of propagating to have
+      // similar try...catch login as in the scheduler thread.
+      try {
+        if (options.m_execution != SchedulerOptions::Execution::ScheduledOnly) {
+          if (options.m_execution == SchedulerOptions::Execution::ImmediateWithSleep) {
+            auto &clock {m_executor->getClock()};
+            clock.sleepUntil(clock.now() + takeNextDuration(job.m_options, job.m_backoff_state));
+          }
+
+          SchedulerStopToken stop_token {[&stop_requested]() {
+            stop_requested = true;
+          }};
+          invokeJobUnlocked(job, stop_token);
+        }
+
+        if (stop_requested) {
+          completeJobUnlocked(job, SchedulerOutcome::Success);
+        } else if (const auto give_up_outcome {enqueueJobUnlocked(job_id, job)}) {
+          completeJobUnlocked(job, *give_up_outcome);
+        } else {
+          m_jobs.emplace(job_id, std::move(job));
+          m_job_count = m_jobs.size();
+          armExecutorUnlocked();
+          return true;
+        }
+      } catch (const std::exception &error) {  // NOSONAR(cpp:S1181): Scheduler callback boundary must catch standard callback failures.
+        detail::logSchedulerException(error, error_context);
+        completeJobUnlocked(job, SchedulerOutcome::Exception, std::current_exception());
+      }
+
+      return false;
     }
 
     template<class SelfT>
@@ -384,82 +936,310 @@ namespace display_device {
       }
     }
 
-    void runThreadLoop() {
-      std::unique_lock lock {m_mutex};
-      while (m_keep_alive) {
-        m_syncing_thread = false;
-        waitForNextRetry(lock);
+    /**
+     * @brief Invoked by the executor once the earliest retry deadline expires or async work is queued.
+     */
+    void runScheduledRetry() {
+      std::vector<std::coroutine_handle<>> resume_handles;
+      {
+        const CompletingLock lock {*this};
+        runAsyncTasksUnlocked();
+
+        // Only the jobs that are due at the time of wake-up are executed, so that a job
+        // with a short duration cannot starve the others.
+        const auto now {m_executor->getClock().now()};
+        while (!m_job_queue.empty() && m_job_queue.front().first <= now) {
+          const auto [retry_time, job_id] {popJobQueueUnlocked()};
+          const auto job_it {m_jobs.find(job_id)};
+          if (job_it == std::end(m_jobs) || job_it->second.m_next_retry_time != retry_time) {
+            // Job was cancelled or replaced while in the queue.
+            continue;
+          }
 
-        if (m_syncing_thread) {
-          // Thread was waken up to sync sleep time or to be stopped.
-          continue;
+          runJobUnlocked(job_id, job_it->second);
         }
 
-        try {
-          SchedulerStopToken scheduler_stop_token {[this]() {
-            clearThreadLoopUnlocked();
-          }};
-          m_retry_function(*m_iface, scheduler_stop_token);
-          continue;
-        } catch (const std::exception &error) {  // NOSONAR(cpp:S1181): Scheduler callback boundary must catch standard callback failures.
-          detail::logSchedulerException(error, "Exception thrown in the RetryScheduler thread. Stopping scheduler.");
+        armExecutorUnlocked();
+        resume_handles.swap(m_resume_handles);
+      }
+
+      for (const auto handle : resume_handles) {
+        handle.resume();
+      }
+    }
+
+    /**
+     * @brief Queue the task and wake up the executor to run it as soon as possible.
+     * @note Only the queue lock is taken, so that the caller is not blocked by the running callbacks.
+     */
+    void enqueueAsyncTask(AsyncTask task) const {
+      std::lock_guard lock {m_async_mutex};
+      m_async_tasks.push_back(std::move(task));
+      m_executor->arm(m_client_id, m_executor->getClock().now());
+    }
+
+    /**
+     * @brief Make the job(s) due right now.
+     * @param job_id Job to trigger, all of the jobs if empty.
+     * @note The jobs are executed in the same `runScheduledRetry` pass as this function.
+     */
+    void triggerUnlocked(const std::optional<SchedulerJobId> job_id) {
+      const auto now {m_executor->getClock().now()};
+      const auto trigger_job {[this, now](const SchedulerJobId id, ScheduledJob &job) {
+        if (job.m_next_retry_time <= now) {
+          // Already due, the previous entry will do.
+          return;
         }
 
-        clearThreadLoopUnlocked();
+        job.m_next_retry_time = now;
+        m_job_queue.emplace_back(job.m_next_retry_time, id);
+        std::ranges::push_heap(m_job_queue, std::greater {});
+      }};
+
+      if (job_id) {
+        if (const auto job_it {m_jobs.find(*job_id)}; job_it != std::end(m_jobs)) {
+          trigger_job(job_it->first, job_it->second);
+        }
+        return;
+      }
+
+      for (auto &[id, job] : m_jobs) {
+        trigger_job(id, job);
       }
     }
 
-    void waitForNextRetry(std::unique_lock<std::mutex> &lock) {
-      if (const auto duration {takeNextDuration(m_sleep_durations)}; duration > std::chrono::milliseconds::zero()) {
-        // We're going to sleep until manually woken up or the time elapses.
-        m_sleep_cv.wait_for(lock, duration, [this]() {
-          return m_syncing_thread;
-        });
+    /**
+     * @brief Run all of the queued tasks.
+     */
+    void runAsyncTasksUnlocked() {
+      std::vector<AsyncTask> tasks;
+      {
+        std::lock_guard lock {m_async_mutex};
+        tasks.swap(m_async_tasks);
+      }
+
+      for (const auto &task : tasks) {
+        task.m_run();
+      }
+    }
+
+    /**
+     * @brief Execute the job and put it back into the queue unless it was stopped.
+     */
+    void runJobUnlocked(const SchedulerJobId job_id, ScheduledJob &job) {
+      bool stop_requested {false};
+      try {
+        SchedulerStopToken scheduler_stop_token {[&stop_requested]() {
+          stop_requested = true;
+        }};
+        invokeJobUnlocked(job, scheduler_stop_token);
+      } catch (const std::exception &error) {  // NOSONAR(cpp:S1181): Scheduler callback boundary must catch standard callback failures.
+        detail::logSchedulerException(error, job_id == m_primary_job_id ? "Exception thrown in the RetryScheduler thread. Stopping scheduler." : "Exception thrown in the RetryScheduler thread. Stopping job.");
+        finishJobUnlocked(job_id, SchedulerOutcome::Exception, std::current_exception());
         return;
       }
 
-      // We're going to sleep until manually woken up.
-      m_sleep_cv.wait(lock, [this]() {
-        return m_syncing_thread;
-      });
+      if (stop_requested) {
+        finishJobUnlocked(job_id, SchedulerOutcome::Success);
+      } else if (const auto give_up_outcome {enqueueJobUnlocked(job_id, job)}) {
+        finishJobUnlocked(job_id, *give_up_outcome);
+      }
     }
 
     /**
-     * @brief Clear the necessary data so that the thread will go into a deep sleep.
+     * @brief Invoke the job's function and record the attempt.
      */
-    void clearThreadLoopUnlocked() {
-      m_sleep_durations = {};
-      m_retry_function = nullptr;
+    void invokeJobUnlocked(ScheduledJob &job, SchedulerStopToken &stop_token) {
+      job.m_attempts++;
+      if (!m_metrics) {
+        job.m_function(*m_iface, stop_token);
+        return;
+      }
+
+      const auto start {std::chrono::steady_clock::now()};
+      try {
+        job.m_function(*m_iface, stop_token);
+      } catch (...) {  // NOSONAR(cpp:S2738): The attempt is recorded and the exception is rethrown as is.
+        m_metrics->recordAttempt(std::chrono::steady_clock::now() - start);
+        throw;
+      }
+      m_metrics->recordAttempt(std::chrono::steady_clock::now() - start);
+    }
+
+    /**
+     * @brief Record the metrics and queue the completion callback of the finished job.
+     * @note The time to success is measured with the executor's clock.
+     * @note The callback is invoked by the `CompletingLock` once it releases the scheduler's lock.
+     */
+    void completeJobUnlocked(const ScheduledJob &job, const SchedulerOutcome outcome, std::exception_ptr exception = nullptr) {
+      if (m_metrics) {
+        switch (outcome) {
+          case SchedulerOutcome::Success:
+            m_metrics->recordSuccess(job.m_attempts, m_executor->getClock().now() - job.m_started_at);
+            break;
+          case SchedulerOutcome::Exception:
+            m_metrics->recordException(job.m_attempts);
+            break;
+          case SchedulerOutcome::TimedOut:
+          case SchedulerOutcome::AttemptsExhausted:
+            m_metrics->recordGiveUp(job.m_attempts);
+            break;
+          case SchedulerOutcome::Cancelled:
+            break;
+        }
+      }
+
+      if (!job.m_options.m_on_completion) {
+        return;
+      }
+
+      m_pending_completions.push_back({.m_callback = job.m_options.m_on_completion, .m_completion = {.m_outcome = outcome, .m_attempts = job.m_attempts, .m_exception = std::move(exception)}});
+    }
+
+    /**
+     * @brief Remove the job that is no longer to be executed and complete it.
+     * @note The job is removed before the completion callback is queued.
+     */
+    void finishJobUnlocked(const SchedulerJobId job_id, const SchedulerOutcome outcome, std::exception_ptr exception = nullptr) {
+      auto node {m_jobs.extract(job_id)};
+      if (node.empty()) {
+        return;
+      }
+
+      removeJobUnlocked(job_id);
+      completeJobUnlocked(node.mapped(), outcome, std::move(exception));
+    }
+
+    /**
+     * @brief Take the next sleep duration of the job and push it into the min-heap.
+     * @returns Empty optional if the job was queued, otherwise the reason why it was given up.
+     */
+    std::optional<SchedulerOutcome> enqueueJobUnlocked(const SchedulerJobId job_id, ScheduledJob &job) {
+      const auto &options {job.m_options};
+      if (options.m_max_attempts && job.m_attempts >= *options.m_max_attempts) {
+        DD_LOG_CAT(scheduler, warning) << "RetryScheduler gave up after " << job.m_attempts << " attempt(s).";
+        return SchedulerOutcome::AttemptsExhausted;
+      }
+
+      const auto next_retry_time {m_executor->getClock().now() + takeNextDuration(options, job.m_backoff_state)};
+      if (options.m_deadline && next_retry_time > job.m_started_at + *options.m_deadline) {
+        DD_LOG_CAT(scheduler, warning) << "RetryScheduler gave up after " << job.m_attempts << " attempt(s) as the deadline would be exceeded.";
+        return SchedulerOutcome::TimedOut;
+      }
+
+      job.m_next_retry_time = next_retry_time;
+      m_job_queue.emplace_back(job.m_next_retry_time, job_id);
+      std::ranges::push_heap(m_job_queue, std::greater {});
+      return std::nullopt;
     }
 
     /**
-     * @brief Manually wake up the thread for synchronization.
+     * @brief Remove the earliest entry from the min-heap.
      */
-    void syncThreadUnlocked() {
-      m_syncing_thread = true;
-      m_sleep_cv.notify_one();
+    JobQueueEntry popJobQueueUnlocked() {
+      std::ranges::pop_heap(m_job_queue, std::greater {});
+      const auto entry {m_job_queue.back()};
+      m_job_queue.pop_back();
+      return entry;
     }
 
     /**
-     * @brief Stop the scheduled function.
+     * @brief Let the executor know when the earliest job is due (if any).
+     */
+    void armExecutorUnlocked() {
+      // The queue lock is held until the executor is armed, otherwise a concurrently
+      // queued task could have its wake-up overwritten by a later deadline.
+      std::lock_guard async_lock {m_async_mutex};
+      if (!m_async_tasks.empty()) {
+        m_executor->arm(m_client_id, m_executor->getClock().now());
+        return;
+      }
+
+      // Discard stale entries so that the executor is not woken up needlessly.
+      while (!m_job_queue.empty()) {
+        const auto &[retry_time, job_id] {m_job_queue.front()};
+        if (const auto job_it {m_jobs.find(job_id)}; job_it != std::end(m_jobs) && job_it->second.m_next_retry_time == retry_time) {
+          break;
+        }
+
+        popJobQueueUnlocked();
+      }
+
+      if (m_job_queue.empty()) {
+        m_executor->disarm(m_client_id);
+        return;
+      }
+
+      m_executor->arm(m_client_id, m_job_queue.front().first);
+    }
+
+    /**
+     * @brief Remove the job so that it is no longer executed.
+     */
+    void cancelUnlocked(const SchedulerJobId job_id) {
+      finishJobUnlocked(job_id, SchedulerOutcome::Cancelled);
+    }
+
+    /**
+     * @brief Update the bookkeeping after the job was removed from the job map.
+     * @note The stale min-heap entries are removed lazily or once they start to dominate the heap.
+     */
+    void removeJobUnlocked(const SchedulerJobId job_id) {
+      if (m_primary_job_id == job_id) {
+        m_primary_job_id = std::nullopt;
+      }
+
+      m_job_count = m_jobs.size();
+      if (m_job_queue.size() > 2 * m_jobs.size()) {
+        std::erase_if(m_job_queue, [this](const JobQueueEntry &entry) {
+          const auto job_it {m_jobs.find(entry.second)};
+          return job_it == std::end(m_jobs) || job_it->second.m_next_retry_time != entry.first;
+        });
+        std::ranges::make_heap(m_job_queue, std::greater {});
+      }
+    }
+
+    /**
+     * @brief Clear all of the jobs so that they are no longer executed.
+     */
+    void clearThreadLoopUnlocked() {
+      auto jobs {std::exchange(m_jobs, {})};
+      m_job_queue.clear();
+      m_primary_job_id = std::nullopt;
+      m_job_count = 0;
+
+      for (const auto &[job_id, job] : jobs) {
+        completeJobUnlocked(job, SchedulerOutcome::Cancelled);
+      }
+    }
+
+    /**
+     * @brief Stop all of the scheduled functions.
      */
     void stopUnlocked() {
       if (isScheduled()) {
         clearThreadLoopUnlocked();
-        syncThreadUnlocked();
+        armExecutorUnlocked();
       }
     }
 
     std::unique_ptr<T> m_iface;  ///< Interface to be passed around to the executor functions.
-    std::vector<std::chrono::milliseconds> m_sleep_durations;  ///< Sleep times for the timer.
-    std::function<void(T &, SchedulerStopToken &)> m_retry_function {nullptr};  ///< Function to be executed until it succeeds.
+    std::unordered_map<SchedulerJobId, ScheduledJob> m_jobs;  ///< Scheduled functions.
+    std::vector<JobQueueEntry> m_job_queue;  ///< Min-heap of the retry times.
+    std::optional<SchedulerJobId> m_primary_job_id;  ///< Job managed by the `schedule` method.
+    SchedulerJobId m_next_job_id {1};  ///< Handle to be assigned to the next job.
+    std::atomic_size_t m_job_count {0};  ///< Number of scheduled jobs, readable without locking.
+    mutable std::vector<AsyncTask> m_async_tasks;  ///< Tasks queued via `executeAsync` or `coExecute`.
+    mutable std::vector<std::coroutine_handle<>> m_resume_handles;  ///< Coroutines to be resumed once the lock is released.
+    std::vector<PendingCompletion> m_pending_completions;  ///< Completion callbacks to be invoked once the lock is released.
+
+    std::shared_ptr<SchedulerMetrics> m_metrics;  ///< Optional telemetry, never reassigned.
 
-    mutable std::mutex m_mutex {};  ///< A mutex for synchronizing thread and "external" access.
-    std::condition_variable m_sleep_cv {};  ///< Condition variable for waking up thread.
-    bool m_syncing_thread {false};  ///< Safeguard for the condition variable to prevent sporadic thread wake-ups.
-    bool m_keep_alive {true};  ///< When set to false, scheduler thread will exit.
+    mutable MutexT m_mutex {};  ///< A mutex for synchronizing executor and "external" access.
+    mutable std::mutex m_async_mutex {};  ///< A mutex for the async task queue, never held while acquiring `m_mutex`.
 
     // Always the last in the list so that all the members are already initialized!
-    std::thread m_thread; /* NOSONAR(cpp:S6168): std::jthread is unavailable on the macOS libc++ used by CI. */  ///< A scheduler thread.
+    std::shared_ptr<SchedulerExecutor> m_executor;  ///< Executor invoking the scheduled functions.
+    SchedulerExecutor::ClientId m_client_id;  ///< Identifier of this scheduler in the executor.
   };
 }  // namespace display_device
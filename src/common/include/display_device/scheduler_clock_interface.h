@@ -0,0 +1,68 @@
+/**
+ * @file src/common/include/display_device/scheduler_clock_interface.h
+ * @brief Declarations for the SchedulerClockInterface.
+ */
+#pragma once
+
+// system includes
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace display_device {
+  /**
+   * @brief A monotonic clock and timer used by the SchedulerExecutor and the RetryScheduler.
+   *
+   * Allows to replace the real time with a virtual one, so that the retry schedules
+   * can be verified without actually sleeping.
+   */
+  class SchedulerClockInterface {
+  public:
+    /**
+     * @brief Time point type of the clock.
+     */
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    /**
+     * @brief Default virtual destructor.
+     */
+    virtual ~SchedulerClockInterface() = default;
+
+    /**
+     * @brief Get the current time.
+     * @returns Current time point.
+     * @examples
+     * const SchedulerClockInterface* iface = getIface(...);
+     * const auto deadline = iface->now() + 100ms;
+     * @examples_end
+     */
+    [[nodiscard]] virtual TimePoint now() const = 0;
+
+    /**
+     * @brief Block the calling thread until the time point is reached.
+     * @param time_point Time point to sleep until.
+     * @examples
+     * SchedulerClockInterface* iface = getIface(...);
+     * iface->sleepUntil(iface->now() + 100ms);
+     * @examples_end
+     */
+    virtual void sleepUntil(TimePoint time_point) = 0;
+
+    /**
+     * @brief Wait for the condition variable to be notified or for the time point to be reached.
+     * @param cv Condition variable to wait on.
+     * @param lock Lock to be released while waiting, same as for `std::condition_variable::wait_until`.
+     * @param time_point Time point to wait until.
+     * @note Same as `std::condition_variable::wait_until`, spurious wake-ups are possible.
+     * @examples
+     * std::mutex mutex;
+     * std::condition_variable cv;
+     * std::unique_lock lock {mutex};
+     *
+     * SchedulerClockInterface* iface = getIface(...);
+     * iface->waitUntil(cv, lock, iface->now() + 100ms);
+     * @examples_end
+     */
+    virtual void waitUntil(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, TimePoint time_point) = 0;
+  };
+}  // namespace display_device
@@ -0,0 +1,174 @@
+/**
+ * @file src/common/include/display_device/scheduler_executor.h
+ * @brief Declarations for the SchedulerExecutor.
+ */
+#pragma once
+
+// system includes
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// local includes
+#include "scheduler_clock_interface.h"
+
+namespace display_device {
+  /**
+   * @brief A timer queue with an optional worker pool that can host many RetryScheduler instances.
+   *
+   * Each attached client has at most one pending deadline. All deadlines are kept in a single
+   * ordered queue that is serviced by one timer thread, so the number of threads does not grow
+   * with the number of attached clients.
+   *
+   * @note Client callbacks are never invoked while the internal mutex is held and a single client
+   *       callback is never invoked concurrently with itself.
+   * @note Without the worker threads, the callbacks are invoked in the timer thread, so a slow callback
+   *       (e.g. a retry or a waiting `RetryScheduler::execute` call) delays the deadlines of all the other
+   *       clients. Hence the executors shared between the schedulers have a small worker pool by default.
+   * @examples
+   * const auto executor {std::make_shared<SchedulerExecutor>(2)};
+   * RetryScheduler<SettingsManagerInterface> scheduler_a {getIface(...), executor};
+   * RetryScheduler<SettingsManagerInterface> scheduler_b {getIface(...), executor};
+   * @examples_end
+   */
+  class SchedulerExecutor final {
+  public:
+    /**
+     * @brief Time point type used for all of the deadlines.
+     */
+    using TimePoint = SchedulerClockInterface::TimePoint;
+
+    /**
+     * @brief Identifier of the attached client.
+     */
+    using ClientId = std::uint64_t;
+
+    /**
+     * @brief Number of the worker threads used if not specified otherwise.
+     */
+    static constexpr std::size_t m_default_worker_count {2};
+
+    /**
+     * @brief Default constructor.
+     * @param worker_count Number of worker threads to invoke the client callbacks in.
+     *                     If 0, the callbacks are invoked directly in the timer thread.
+     * @param clock [Optional] Clock to measure the deadlines with. If not provided, `SteadySchedulerClock` is used.
+     */
+    explicit SchedulerExecutor(std::size_t worker_count = m_default_worker_count, std::shared_ptr<SchedulerClockInterface> clock = nullptr);
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    SchedulerExecutor(const SchedulerExecutor &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    SchedulerExecutor &operator=(const SchedulerExecutor &) = delete;
+
+    /**
+     * @brief A destructor that gracefully shuts down all of the threads.
+     */
+    ~SchedulerExecutor();
+
+    /**
+     * @brief Attach a new client to the executor.
+     * @param callback Function to be invoked once the client's deadline expires.
+     * @returns Identifier to be used for the other methods.
+     */
+    [[nodiscard]] ClientId addClient(std::function<void()> callback);
+
+    /**
+     * @brief Detach the client from the executor.
+     * @param client_id Identifier of the client.
+     * @note Blocks until the client's callback is no longer running. Must not
+     *       be called from within the client's callback.
+     */
+    void removeClient(ClientId client_id);
+
+    /**
+     * @brief Set (or replace) the deadline of the client.
+     * @param client_id Identifier of the client.
+     * @param due_time Time point at which the client's callback is to be invoked.
+     */
+    void arm(ClientId client_id, TimePoint due_time);
+
+    /**
+     * @brief Remove the pending deadline of the client (if any).
+     * @param client_id Identifier of the client.
+     */
+    void disarm(ClientId client_id);
+
+    /**
+     * @brief Get the number of worker threads.
+     * @returns Worker thread count, 0 if the callbacks are invoked in the timer thread.
+     */
+    [[nodiscard]] std::size_t getWorkerCount() const;
+
+    /**
+     * @brief Get the clock used for the deadlines.
+     * @returns Clock reference, valid for the lifetime of the executor.
+     */
+    [[nodiscard]] SchedulerClockInterface &getClock() const;
+
+  private:
+    /**
+     * @brief Internal client data.
+     */
+    struct Client {
+      std::function<void()> m_callback;  ///< Function to be invoked once the deadline expires.
+      std::optional<TimePoint> m_due_time {};  ///< Currently pending deadline.
+      bool m_queued {false};  ///< Whether the client is waiting for a free worker.
+      bool m_running {false};  ///< Whether the callback is currently being invoked.
+      bool m_rerun {false};  ///< Whether the deadline expired again while the callback was running.
+      bool m_removed {false};  ///< Whether the client is being detached.
+    };
+
+    using TimerEntry = std::pair<TimePoint, ClientId>;
+
+    void runTimerLoop();
+    void runWorkerLoop();
+
+    /**
+     * @brief Remove the client's deadline from the timer queue.
+     */
+    void disarmUnlocked(Client &client, ClientId client_id);
+
+    /**
+     * @brief Hand over the expired client to a worker thread.
+     */
+    void dispatchUnlocked(Client &client, ClientId client_id);
+
+    /**
+     * @brief Invoke the client callback with the mutex temporarily unlocked.
+     */
+    void invokeUnlocked(std::unique_lock<std::mutex> &lock, Client &client);
+
+    std::size_t m_worker_count;  ///< Number of worker threads.
+    std::shared_ptr<SchedulerClockInterface> m_clock;  ///< Clock to measure the deadlines with.
+    std::unordered_map<ClientId, Client> m_clients;  ///< Attached clients.
+    std::set<TimerEntry> m_timers;  ///< Pending deadlines ordered by time.
+    std::deque<ClientId> m_ready;  ///< Clients waiting for a free worker.
+    ClientId m_next_client_id {1};  ///< Identifier to be assigned for the next client.
+
+    std::mutex m_mutex {};  ///< A mutex for synchronizing threads and "external" access.
+    std::condition_variable m_timer_cv {};  ///< Condition variable for waking up the timer thread.
+    std::condition_variable m_worker_cv {};  ///< Condition variable for waking up the worker threads.
+    std::condition_variable m_idle_cv {};  ///< Condition variable for signaling finished callbacks.
+    bool m_keep_alive {true};  ///< When set to false, all threads will exit.
+
+    // Always the last in the list so that all the members are already initialized!
+    std::vector<std::thread> m_workers; /* NOSONAR(cpp:S6168): std::jthread is unavailable on the macOS libc++ used by CI. */  ///< Worker threads.
+    std::thread m_timer_thread; /* NOSONAR(cpp:S6168): std::jthread is unavailable on the macOS libc++ used by CI. */  ///< Timer thread.
+  };
+}  // namespace display_device
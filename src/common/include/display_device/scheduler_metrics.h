@@ -0,0 +1,166 @@
+/**
+ * @file src/common/include/display_device/scheduler_metrics.h
+ * @brief Declarations for the SchedulerMetrics.
+ */
+#pragma once
+
+// system includes
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace display_device {
+  /**
+   * @brief A point-in-time copy of the MetricsHistogram.
+   */
+  struct MetricsHistogramSnapshot {
+    /**
+     * @brief Number of the buckets in the histogram.
+     */
+    static constexpr std::size_t m_bucket_count {32};
+
+    std::array<std::uint64_t, m_bucket_count> m_buckets {};  ///< Number of values in each bucket. See `getBucketUpperBound` for the ranges.
+    std::uint64_t m_count {0};  ///< Total number of the recorded values.
+    std::uint64_t m_sum {0};  ///< Sum of the recorded values.
+    std::uint64_t m_max {0};  ///< Largest recorded value.
+
+    /**
+     * @brief Get the largest value that falls into the bucket.
+     * @param index Index of the bucket.
+     * @returns Inclusive upper bound of the bucket - bucket 0 holds only 0, bucket `i` holds
+     *          the values in range [2^(i-1), 2^i - 1] and the last bucket holds everything else.
+     */
+    [[nodiscard]] static std::uint64_t getBucketUpperBound(std::size_t index);
+
+    /**
+     * @brief Estimate the percentile from the buckets.
+     * @param percentile Percentile in range [0, 100].
+     * @returns Upper bound of the bucket that contains the percentile (capped at `m_max`), 0 if there are no values.
+     * @examples
+     * const auto p99 = snapshot.m_callback_duration_us.getPercentile(99);
+     * @examples_end
+     */
+    [[nodiscard]] std::uint64_t getPercentile(double percentile) const;
+  };
+
+  /**
+   * @brief Lock-free histogram with fixed power-of-two buckets.
+   *
+   * Recording a value is a handful of relaxed atomic operations, so it can be
+   * used on the hot paths without noticeable overhead.
+   */
+  class MetricsHistogram {
+  public:
+    /**
+     * @brief Record the value.
+     * @param value Value to record.
+     */
+    void record(std::uint64_t value);
+
+    /**
+     * @brief Record the duration in microseconds.
+     * @param duration Duration to record. Negative durations are recorded as 0.
+     */
+    void recordDuration(std::chrono::nanoseconds duration);
+
+    /**
+     * @brief Take a snapshot of the histogram.
+     * @returns Copy of the current values.
+     * @note The values are read one by one, therefore a snapshot taken during the concurrent
+     *       updates may be slightly inconsistent (e.g. bucket sum differing from the count).
+     */
+    [[nodiscard]] MetricsHistogramSnapshot snapshot() const;
+
+  private:
+    std::array<std::atomic_uint64_t, MetricsHistogramSnapshot::m_bucket_count> m_buckets {};  ///< Number of values in each bucket.
+    std::atomic_uint64_t m_count {0};  ///< Total number of the recorded values.
+    std::atomic_uint64_t m_sum {0};  ///< Sum of the recorded values.
+    std::atomic_uint64_t m_max {0};  ///< Largest recorded value.
+  };
+
+  /**
+   * @brief A point-in-time copy of the SchedulerMetrics.
+   */
+  struct SchedulerMetricsSnapshot {
+    std::uint64_t m_schedules {0};  ///< Number of the scheduled functions.
+    std::uint64_t m_attempts {0};  ///< Number of the scheduled function invocations.
+    std::uint64_t m_successes {0};  ///< Number of the scheduled functions that requested to stop.
+    std::uint64_t m_exceptions {0};  ///< Number of the exceptions caught from the scheduled functions.
+    std::uint64_t m_give_ups {0};  ///< Number of the scheduled functions that ran out of attempts or time.
+    MetricsHistogramSnapshot m_attempts_per_schedule;  ///< Number of invocations until the scheduled function has finished.
+    MetricsHistogramSnapshot m_time_to_success_us;  ///< Time from scheduling until the stop request, in microseconds.
+    MetricsHistogramSnapshot m_callback_duration_us;  ///< Duration of the scheduled function invocations, in microseconds.
+    MetricsHistogramSnapshot m_mutex_wait_us;  ///< Time the `execute` callers have waited for the lock, in microseconds.
+  };
+
+  /**
+   * @brief Optional telemetry of the RetryScheduler.
+   *
+   * The same instance can be shared between many schedulers to aggregate their metrics.
+   * @examples
+   * const auto metrics {std::make_shared<SchedulerMetrics>()};
+   * RetryScheduler<SettingsManagerInterface> scheduler {getIface(...), nullptr, metrics};
+   *
+   * // Later, e.g. in the monitoring thread
+   * const auto snapshot {metrics->snapshot()};
+   * exportGauge("scheduler_attempts", snapshot.m_attempts);
+   * @examples_end
+   */
+  class SchedulerMetrics {
+  public:
+    /**
+     * @brief Record a newly scheduled function.
+     */
+    void recordSchedule();
+
+    /**
+     * @brief Record a single invocation of the scheduled function.
+     * @param duration How long the invocation took.
+     */
+    void recordAttempt(std::chrono::nanoseconds duration);
+
+    /**
+     * @brief Record the scheduled function that requested to stop.
+     * @param attempts Number of invocations it took.
+     * @param time_to_success Time from scheduling until the stop request.
+     */
+    void recordSuccess(std::uint64_t attempts, std::chrono::nanoseconds time_to_success);
+
+    /**
+     * @brief Record the scheduled function that was stopped due to an exception.
+     * @param attempts Number of invocations it took.
+     */
+    void recordException(std::uint64_t attempts);
+
+    /**
+     * @brief Record the scheduled function that ran out of attempts or time.
+     * @param attempts Number of invocations it took.
+     */
+    void recordGiveUp(std::uint64_t attempts);
+
+    /**
+     * @brief Record the time spent waiting for the scheduler's lock.
+     * @param duration How long the wait took.
+     */
+    void recordMutexWait(std::chrono::nanoseconds duration);
+
+    /**
+     * @brief Take a snapshot of the metrics.
+     * @returns Copy of the current values.
+     */
+    [[nodiscard]] SchedulerMetricsSnapshot snapshot() const;
+
+  private:
+    std::atomic_uint64_t m_schedules {0};  ///< Number of the scheduled functions.
+    std::atomic_uint64_t m_attempts {0};  ///< Number of the scheduled function invocations.
+    std::atomic_uint64_t m_successes {0};  ///< Number of the scheduled functions that requested to stop.
+    std::atomic_uint64_t m_exceptions {0};  ///< Number of the exceptions caught from the scheduled functions.
+    std::atomic_uint64_t m_give_ups {0};  ///< Number of the scheduled functions that ran out of attempts or time.
+    MetricsHistogram m_attempts_per_schedule;  ///< Number of invocations until the scheduled function has finished.
+    MetricsHistogram m_time_to_success_us;  ///< Time from scheduling until the stop request, in microseconds.
+    MetricsHistogram m_callback_duration_us;  ///< Duration of the scheduled function invocations, in microseconds.
+    MetricsHistogram m_mutex_wait_us;  ///< Time the `execute` callers have waited for the lock, in microseconds.
+  };
+}  // namespace display_device
@@ -6,10 +6,97 @@
 
 // system includes
 #include <cstdint>
+#include <memory>
 #include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace display_device {
+  /**
+   * @brief Defines how the persistent state is encoded before it is stored.
+   * @note Both of the encodings can always be loaded, regardless of the chosen one.
+   */
+  enum class PersistenceEncoding {
+    Json,  ///< Human-readable indented JSON.
+    Binary  ///< Versioned binary header followed by CBOR. Smaller and faster to parse, but not readable by the older versions.
+  };
+
+  /**
+   * @brief Defines when the persistent state is loaded.
+   */
+  enum class PersistenceLoadMode {
+    Eager,  ///< Loaded and parsed as soon as the persistent state is constructed.
+    Lazy  ///< Loaded and parsed on the first access to the state. Load errors are reported by that access instead.
+  };
+
+  /**
+   * @brief Read-only view of the loaded settings data that keeps the underlying storage alive.
+   *
+   * The storage can be an owned buffer or a buffer shared with the implementation (e.g. the pending
+   * data of the WriteBehindSettingsPersistence), so that the data can be parsed without copying it first.
+   */
+  class SettingsDataView {
+  public:
+    /**
+     * @brief Default constructor for the view of no data.
+     */
+    SettingsDataView() = default;
+
+    /**
+     * @brief Constructor for the view owning the data.
+     * @param data Data to be owned.
+     */
+    explicit SettingsDataView(std::vector<std::uint8_t> data) {
+      const auto owned_data {std::make_shared<const std::vector<std::uint8_t>>(std::move(data))};
+      m_data = *owned_data;
+      m_storage = owned_data;
+    }
+
+    /**
+     * @brief Constructor for the view of the external storage.
+     * @param data View of the data.
+     * @param storage Shared storage that the data points to. It is released once the last copy of the view is destroyed.
+     */
+    SettingsDataView(const std::span<const std::uint8_t> data, std::shared_ptr<const void> storage):
+        m_storage {std::move(storage)},
+        m_data {data} {
+    }
+
+    /**
+     * @brief Get the viewed data.
+     * @returns View of the bytes, valid for as long as this view (or its copy) is alive.
+     */
+    [[nodiscard]] std::span<const std::uint8_t> getData() const {
+      return m_data;
+    }
+
+    /**
+     * @brief Get the viewed data as characters.
+     * @returns View of the characters, valid for as long as this view (or its copy) is alive.
+     * @examples
+     * const auto view {iface->loadView()};
+     * const bool success {fromJson(view->getString(), state)};
+     * @examples_end
+     */
+    [[nodiscard]] std::string_view getString() const {
+      return {reinterpret_cast<const char *>(m_data.data()), m_data.size()};
+    }
+
+    /**
+     * @brief Check whether there is no data.
+     * @returns True if the view is empty.
+     */
+    [[nodiscard]] bool empty() const {
+      return m_data.empty();
+    }
+
+  private:
+    std::shared_ptr<const void> m_storage {};  ///< Keeps the viewed data alive.
+    std::span<const std::uint8_t> m_data {};  ///< Viewed data.
+  };
+
   /**
    * @brief A class for storing and loading settings data from a persistent medium.
    */
@@ -44,6 +131,24 @@ namespace display_device {
      */
     [[nodiscard]] virtual std::optional<std::vector<std::uint8_t>> load() const = 0;
 
+    /**
+     * @brief Load saved settings data without copying it (if supported by the implementation).
+     * @returns Same as `load`, except that the data is returned as a view.
+     * @note The default implementation wraps the result of `load`. Implementations that already hold
+     *       the data in memory can override it to share their buffer with the view.
+     * @examples
+     * const SettingsPersistenceInterface* iface = getIface(...);
+     * const auto opt_view = iface->loadView();
+     * @examples_end
+     */
+    [[nodiscard]] virtual std::optional<SettingsDataView> loadView() const {
+      auto data {load()};
+      if (!data) {
+        return std::nullopt;
+      }
+      return SettingsDataView {std::move(*data)};
+    }
+
     /**
      * @brief Clear the persistent settings data.
      * @returns True if data was cleared, false otherwise.
@@ -0,0 +1,155 @@
+/**
+ * @file src/common/include/display_device/single_flight.h
+ * @brief Declarations for the SingleFlight.
+ */
+#pragma once
+
+// system includes
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace display_device {
+  /**
+   * @brief Coalesces concurrent computations with the same key into a single one.
+   *
+   * The first caller for a key performs the computation, while the concurrent callers with
+   * the same key wait for it and receive the same result (or exception). Optionally, successful
+   * results can be cached for a while, so that a burst of calls collapses into one computation.
+   *
+   * @tparam KeyT Key type.
+   * @tparam ValueT Result type, must be copyable.
+   * @tparam HashT Hash function for the key.
+   * @note Failed computations are never cached.
+   * @examples
+   * RetryScheduler<SettingsManagerInterface> scheduler{getIface(...)};
+   * SingleFlight<std::string, EnumeratedDeviceList> flight{100ms};
+   *
+   * // Called from many threads at the same time - only one enumeration is performed
+   * const auto devices = flight.get("devices", [&]() {
+   *   return scheduler.execute([](SettingsManagerInterface& iface) {
+   *     return iface.enumAvailableDevices();
+   *   });
+   * });
+   * @examples_end
+   */
+  template<class KeyT, class ValueT, class HashT = std::hash<KeyT>>
+  class SingleFlight final {
+    static_assert(!std::is_void_v<ValueT> && std::is_copy_constructible_v<ValueT>, "SingleFlight requires a copyable result type!");
+
+  public:
+    /**
+     * @brief Clock used for the cache expiration.
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Default constructor.
+     * @param ttl Time for which the successful result is reused. Zero disables the cache,
+     *            in which case only the concurrent callers share the result.
+     */
+    explicit SingleFlight(const std::chrono::milliseconds ttl = std::chrono::milliseconds::zero()):
+        m_ttl {ttl} {
+    }
+
+    /**
+     * @brief Get the result for the key, computing it only if it is neither in flight nor cached.
+     * @param key Key identifying the computation.
+     * @param compute Function computing the result. It is invoked in the calling thread.
+     * @returns Result of the computation. Exception thrown by the computation is rethrown
+     *          for every caller sharing it.
+     */
+    template<class FunctionT>
+      requires std::is_invocable_r_v<ValueT, FunctionT &>
+    ValueT get(const KeyT &key, FunctionT &&compute) {
+      std::promise<ValueT> promise;
+      std::optional<std::shared_future<ValueT>> shared_future;
+      std::uint64_t generation {};
+      {
+        std::lock_guard lock {m_mutex};
+        const auto entry_it {m_entries.find(key)};
+        if (entry_it != std::end(m_entries) && (!entry_it->second.m_expires_at || *entry_it->second.m_expires_at > Clock::now())) {
+          shared_future = entry_it->second.m_future;
+        } else {
+          generation = m_next_generation++;
+          m_entries.insert_or_assign(key, Entry {.m_future = promise.get_future().share(), .m_generation = generation});
+        }
+      }
+
+      if (shared_future) {
+        // Someone else is computing (or has computed) the result - wait outside of the lock.
+        return shared_future->get();
+      }
+
+      try {
+        ValueT value {compute()};
+        finish(key, generation, true);
+        promise.set_value(value);
+        return value;
+      } catch (...) {  // NOSONAR(cpp:S2738): Any exception is forwarded to the waiting callers.
+        finish(key, generation, false);
+        promise.set_exception(std::current_exception());
+        throw;
+      }
+    }
+
+    /**
+     * @brief Drop the cached result for the key.
+     * @param key Key identifying the computation.
+     * @note Computation in flight is not affected, but its result will not be cached.
+     */
+    void invalidate(const KeyT &key) {
+      std::lock_guard lock {m_mutex};
+      m_entries.erase(key);
+    }
+
+    /**
+     * @brief Drop all of the cached results.
+     * @note Computations in flight are not affected, but their results will not be cached.
+     */
+    void clear() {
+      std::lock_guard lock {m_mutex};
+      m_entries.clear();
+    }
+
+  private:
+    /**
+     * @brief Computation in flight or its cached result.
+     */
+    struct Entry {
+      std::shared_future<ValueT> m_future;  ///< Shared result of the computation.
+      std::uint64_t m_generation {};  ///< Distinguishes the computations for the same key.
+      std::optional<Clock::time_point> m_expires_at {};  ///< Set once the computation has succeeded, empty while it is in flight.
+    };
+
+    /**
+     * @brief Either cache the result or remove the entry once the computation is done.
+     */
+    void finish(const KeyT &key, const std::uint64_t generation, const bool success) {
+      std::lock_guard lock {m_mutex};
+      const auto entry_it {m_entries.find(key)};
+      if (entry_it == std::end(m_entries) || entry_it->second.m_generation != generation) {
+        // Invalidated while in flight.
+        return;
+      }
+
+      if (success && m_ttl > std::chrono::milliseconds::zero()) {
+        entry_it->second.m_expires_at = Clock::now() + m_ttl;
+      } else {
+        m_entries.erase(entry_it);
+      }
+    }
+
+    std::chrono::milliseconds m_ttl;  ///< Time for which the successful result is reused.
+    std::unordered_map<KeyT, Entry, HashT> m_entries;  ///< Computations in flight and cached results.
+    std::uint64_t m_next_generation {0};  ///< Generation to be assigned to the next computation.
+    std::mutex m_mutex {};  ///< A mutex for synchronizing access to the entries.
+  };
+}  // namespace display_device
@@ -0,0 +1,31 @@
+/**
+ * @file src/common/include/display_device/steady_scheduler_clock.h
+ * @brief Declarations for the SteadySchedulerClock.
+ */
+#pragma once
+
+// local includes
+#include "scheduler_clock_interface.h"
+
+namespace display_device {
+  /**
+   * @brief Real time implementation for SchedulerClockInterface based on `std::chrono::steady_clock`.
+   */
+  class SteadySchedulerClock: public SchedulerClockInterface {
+  public:
+    /**
+     * @copydoc SchedulerClockInterface::now
+     */
+    [[nodiscard]] TimePoint now() const override;
+
+    /**
+     * @copydoc SchedulerClockInterface::sleepUntil
+     */
+    void sleepUntil(TimePoint time_point) override;
+
+    /**
+     * @copydoc SchedulerClockInterface::waitUntil
+     */
+    void waitUntil(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, TimePoint time_point) override;
+  };
+}  // namespace display_device
@@ -0,0 +1,332 @@
+/**
+ * @file src/common/include/display_device/trace_sink.h
+ * @brief Declarations for the binary trace sink.
+ */
+#pragma once
+
+// system includes
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// local includes
+#include "logging.h"
+
+namespace display_device {
+  /**
+   * @brief Format string of the trace record together with its static identifier.
+   *
+   * The identifier is a hash of the format string computed at compile time, so it is the
+   * same for every run and only the identifier needs to be stored for each record.
+   */
+  struct TraceFormat {
+    /**
+     * @brief Default constructor.
+     * @param text Format string where every `{}` is replaced with the next argument when decoding.
+     */
+    consteval TraceFormat(const char *text):  // NOSONAR(cpp:S1709): Implicit conversion from the string literal is intended.
+        m_text {text},
+        m_id {makeId(m_text)} {
+    }
+
+    std::string_view m_text;  ///< Format string.
+    std::uint64_t m_id;  ///< Hash of the format string, never 0.
+
+  private:
+    /**
+     * @brief Compute the 64-bit FNV-1a hash of the format string.
+     */
+    static consteval std::uint64_t makeId(const std::string_view text) {
+      std::uint64_t hash {0xcbf29ce484222325};
+      for (const char character : text) {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 0x100000001b3;
+      }
+      // 0 is reserved for the unused entries
+      return hash == 0 ? 1 : hash;
+    }
+  };
+
+  /**
+   * @brief Trace arguments encoded as the raw bytes, without any text formatting.
+   *
+   * Each argument is stored as a 1-byte type tag followed by its value. Integers are widened to
+   * 64 bits, enums are stored as their underlying integer and strings are stored with a 16-bit length.
+   * Arguments that do not fit into the buffer are cut off and the arguments are marked as truncated.
+   */
+  class TraceArguments {
+  public:
+    /**
+     * @brief Argument type tags, in the same order as the `Logger::FieldValue` alternatives.
+     */
+    enum class Type : std::uint8_t {
+      Bool = 1,  ///< 1-byte boolean.
+      Int,  ///< 8-byte signed integer.
+      UInt,  ///< 8-byte unsigned integer.
+      Double,  ///< 8-byte floating point number.
+      String  ///< 2-byte length followed by the characters.
+    };
+
+    /**
+     * @brief Maximum number of the encoded bytes.
+     */
+    static constexpr std::size_t m_capacity {256};
+
+    /**
+     * @brief Default constructor.
+     * @param args Arguments to be encoded. Must be bools, numbers, enums or convertible to `std::string_view`.
+     */
+    template<class... Args>
+    explicit TraceArguments(const Args &...args) {
+      (append(args), ...);
+    }
+
+    /**
+     * @brief Get the encoded arguments.
+     * @returns View of the encoded bytes.
+     */
+    [[nodiscard]] std::span<const std::byte> getBytes() const {
+      return {m_buffer.data(), m_size};
+    }
+
+    /**
+     * @brief Check whether some of the arguments did not fit.
+     * @returns True if the arguments were cut off.
+     */
+    [[nodiscard]] bool isTruncated() const {
+      return m_truncated;
+    }
+
+  private:
+    template<class T>
+    void append(const T &value) {
+      if constexpr (std::is_same_v<T, bool>) {
+        appendValue(Type::Bool, value);
+      } else if constexpr (std::is_enum_v<T>) {
+        append(static_cast<std::underlying_type_t<T>>(value));
+      } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        appendValue(Type::Int, static_cast<std::int64_t>(value));
+      } else if constexpr (std::is_integral_v<T>) {
+        appendValue(Type::UInt, static_cast<std::uint64_t>(value));
+      } else if constexpr (std::is_floating_point_v<T>) {
+        appendValue(Type::Double, static_cast<double>(value));
+      } else {
+        static_assert(std::is_convertible_v<const T &, std::string_view>, "Unsupported argument type for the trace record!");
+        appendString(value);
+      }
+    }
+
+    template<class T>
+    void appendValue(const Type type, const T &value) {
+      if (m_truncated || m_capacity - m_size < 1 + sizeof(T)) {
+        m_truncated = true;
+        return;
+      }
+
+      m_buffer[m_size++] = static_cast<std::byte>(type);
+      std::memcpy(m_buffer.data() + m_size, &value, sizeof(T));
+      m_size += sizeof(T);
+    }
+
+    void appendString(const std::string_view value) {
+      constexpr std::size_t header_size {1 + sizeof(std::uint16_t)};
+      if (m_truncated || m_capacity - m_size < header_size) {
+        m_truncated = true;
+        return;
+      }
+
+      const std::size_t available {m_capacity - m_size - header_size};
+      const auto length {static_cast<std::uint16_t>(std::min(value.size(), available))};
+      m_truncated = length < value.size();
+
+      m_buffer[m_size++] = static_cast<std::byte>(Type::String);
+      std::memcpy(m_buffer.data() + m_size, &length, sizeof(length));
+      m_size += sizeof(length);
+      std::memcpy(m_buffer.data() + m_size, value.data(), length);
+      m_size += length;
+    }
+
+    std::array<std::byte, m_capacity> m_buffer {};  ///< Encoded arguments.
+    std::size_t m_size {0};  ///< Number of the used bytes.
+    bool m_truncated {false};  ///< Whether some of the arguments did not fit.
+  };
+
+  /**
+   * @brief Captures the trace records in a memory-mapped circular file without formatting them.
+   *
+   * Every record stores only the format identifier, the timestamp and the encoded arguments in a
+   * fixed-size slot, while the format strings are stored once in a separate dictionary. Once all of
+   * the slots are used, the oldest records are overwritten. Since the file is memory-mapped,
+   * the records survive a crash of the process and can be rendered as text afterward
+   * with `readTraceFile` (or the `trace_decoder` tool).
+   *
+   * An existing file with the same layout is continued, otherwise it is recreated.
+   *
+   * @note Writing is lock-free, except for the first record of every format string.
+   * @note A record is dropped if its slot is still being written by a writer one lap behind or ahead,
+   *       which can only happen when the writers outpace the capacity. See `getDroppedCount`.
+   * @note The file uses the native byte order, so it must be decoded on the same architecture.
+   * @examples
+   * Logger::get().setTraceSink(std::make_shared<TraceSink>("trace.bin", TraceSink::Options {}));
+   * DD_TRACE("Applying settings for {}, attempt {}", device_id, attempt);
+   * @examples_end
+   */
+  class TraceSink final {
+  public:
+    /**
+     * @brief Layout of the trace file.
+     */
+    struct Options {
+      std::size_t m_record_capacity {8192};  ///< Number of the record slots (records kept before being overwritten).
+      std::size_t m_record_size {128};  ///< Size of a single record slot in bytes. Must be a multiple of 8 in the [64, 4096] range.
+      std::size_t m_format_capacity {512};  ///< Maximum number of the distinct format strings.
+    };
+
+    /**
+     * @brief Default constructor.
+     * @param filepath Path to the trace file. It is created if it does not exist.
+     * @param options Layout of the trace file.
+     * @throws std::invalid_argument if the options are invalid.
+     * @throws std::runtime_error if the file could not be mapped.
+     */
+    explicit TraceSink(std::filesystem::path filepath, const Options &options);
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    TraceSink(const TraceSink &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    TraceSink &operator=(const TraceSink &) = delete;
+
+    /**
+     * @brief A destructor that unmaps the file.
+     */
+    ~TraceSink();
+
+    /**
+     * @brief Capture the record.
+     * @param format Format of the record.
+     * @param arguments Encoded arguments. They are cut off if they do not fit into the record slot.
+     * @note The `DD_TRACE` MACRO should be preferred.
+     */
+    void write(const TraceFormat &format, const TraceArguments &arguments);
+
+    /**
+     * @brief Write the mapped records out to the disk.
+     * @note Not needed for surviving a crash of the process, only for surviving a crash of the system.
+     */
+    void flush();
+
+    /**
+     * @brief Get the path to the trace file.
+     * @returns Path specified in the constructor.
+     */
+    [[nodiscard]] const std::filesystem::path &getFilepath() const;
+
+    /**
+     * @brief Get the number of records dropped because their slot was in use by another writer.
+     * @returns Number of the dropped records since the construction.
+     */
+    [[nodiscard]] std::uint64_t getDroppedCount() const;
+
+  private:
+    class MappedFile;
+
+    /**
+     * @brief Check whether the format string is already stored in the dictionary.
+     */
+    [[nodiscard]] bool isKnownFormat(std::uint64_t format_id) const;
+
+    /**
+     * @brief Store the format string in the dictionary (if there is any space left).
+     */
+    void registerFormat(const TraceFormat &format);
+
+    /**
+     * @brief Mark the format as stored, so that the next records skip the registration.
+     */
+    void insertKnownFormat(std::uint64_t format_id);
+
+    /**
+     * @brief Get the start of the record slot in the mapped file.
+     */
+    [[nodiscard]] std::byte *getSlot(std::size_t index) const;
+
+    std::filesystem::path m_filepath;  ///< Path to the trace file.
+    Options m_options;  ///< Layout of the trace file.
+    std::unique_ptr<MappedFile> m_file;  ///< Mapped trace file.
+    std::unique_ptr<std::atomic<std::uint64_t>[]> m_known_formats; /* NOSONAR(cpp:S5945): Atomics are not movable, so a vector cannot be used. */  ///< Open-addressing set of the stored format identifiers.
+    std::size_t m_known_formats_mask;  ///< Size of the set - 1, used for wrapping the probes.
+    std::atomic_bool m_dictionary_full {false};  ///< Whether there is no space left for the new format strings.
+    std::atomic<std::uint64_t> m_dropped {0};  ///< Number of the records dropped because their slot was in use.
+    std::mutex m_dictionary_mutex {};  ///< Serializes the format string registrations.
+  };
+
+  /**
+   * @brief A trace record decoded from the trace file.
+   */
+  struct TraceRecord {
+    std::uint64_t m_sequence {};  ///< Number of the record since the file was created, starting from 1.
+    std::chrono::system_clock::time_point m_timestamp {};  ///< Time at which the record was captured.
+    std::optional<std::string> m_format {};  ///< Format string, empty if it did not fit into the dictionary.
+    std::vector<Logger::FieldValue> m_arguments {};  ///< Decoded arguments.
+    bool m_truncated {};  ///< Whether some of the arguments were cut off.
+  };
+
+  /**
+   * @brief Read all of the records from the trace file.
+   * @param filepath Path to the trace file.
+   * @returns Records ordered from the oldest to the newest, or empty optional if the file could not be read or is not a trace file.
+   * @examples
+   * const auto records {readTraceFile("trace.bin")};
+   * @examples_end
+   */
+  [[nodiscard]] std::optional<std::vector<TraceRecord>> readTraceFile(const std::filesystem::path &filepath);
+
+  /**
+   * @brief Render the trace record as a line of text.
+   * @param record Record to render.
+   * @returns Text in the "[<UTC timestamp>] <formatted message>" format.
+   * @examples
+   * for (const auto &record : *readTraceFile("trace.bin")) {
+   *   std::cout << formatTraceRecord(record) << std::endl;
+   * }
+   * @examples_end
+   */
+  [[nodiscard]] std::string formatTraceRecord(const TraceRecord &record);
+}  // namespace display_device
+
+/**
+ * @brief Capture the record in the trace sink set via `Logger::setTraceSink`.
+ *
+ * Nothing is evaluated if no trace sink is set. Otherwise, only the raw argument
+ * bytes are captured, the text is formatted when the trace file is decoded.
+ *
+ * @param format String literal where every `{}` is replaced with the next argument.
+ * @examples
+ * DD_TRACE("Applying settings for {}, attempt {}", device_id, attempt);
+ * @examples_end
+ */
+#define DD_TRACE(format, ...) \
+  do { \
+    if (const auto &dd_logger {display_device::Logger::get()}; dd_logger.isTraceEnabled()) { \
+      static constexpr display_device::TraceFormat dd_trace_format {format}; \
+      dd_logger.writeTrace(dd_trace_format, display_device::TraceArguments {__VA_ARGS__}); \
+    } \
+  } while (false)
@@ -0,0 +1,153 @@
+/**
+ * @file src/common/include/display_device/write_behind_settings_persistence.h
+ * @brief Declarations for the WriteBehindSettingsPersistence.
+ */
+#pragma once
+
+// system includes
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// local includes
+#include "settings_persistence_interface.h"
+
+namespace display_device {
+  /**
+   * @brief A SettingsPersistenceInterface decorator that writes the data in a background thread.
+   *
+   * The stores and clears are queued and forwarded to the wrapped interface in the order they were
+   * made. Since every operation replaces the whole data, the queued operations that have not been
+   * picked up yet are superseded by the newer ones, so a slow medium never builds up a backlog.
+   *
+   * Until the latest acknowledged operation has been written successfully, `load` and `loadView` return
+   * its data instead of reading from the wrapped interface.
+   *
+   * @examples
+   * const auto persistence {std::make_shared<WriteBehindSettingsPersistence>(std::make_shared<FileSettingsPersistence>("settings.json"))};
+   * const auto result = persistence->store(data);  // Returns without waiting for the file write
+   * const auto flushed = persistence->flush();  // Waits for the file write
+   * @examples_end
+   */
+  class WriteBehindSettingsPersistence final: public SettingsPersistenceInterface {
+  public:
+    /**
+     * @brief Defines when the store and clear operations return.
+     */
+    enum class Policy {
+      Latency,  ///< Return true as soon as the operation is queued. Failed writes are logged and reported by `flush`.
+      Durability  ///< Wait for the operation (or a newer one that superseded it) to be written and return the result of that write. A failed operation is not acknowledged.
+    };
+
+    /**
+     * @brief Default constructor.
+     * @param persistence_api Interface to forward the operations to.
+     * @param policy Specify when the store and clear operations return.
+     * @throws std::invalid_argument if the interface is nullptr.
+     */
+    explicit WriteBehindSettingsPersistence(std::shared_ptr<SettingsPersistenceInterface> persistence_api, Policy policy = Policy::Latency);
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    WriteBehindSettingsPersistence(const WriteBehindSettingsPersistence &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    WriteBehindSettingsPersistence &operator=(const WriteBehindSettingsPersistence &) = delete;
+
+    /**
+     * @brief A destructor that writes the queued operation before shutting down the thread.
+     */
+    ~WriteBehindSettingsPersistence() override;
+
+    /**
+     * @copydoc SettingsPersistenceInterface::store
+     */
+    [[nodiscard]] bool store(const std::vector<std::uint8_t> &data) override;
+
+    /**
+     * @copydoc SettingsPersistenceInterface::load
+     * @note Returns the latest stored data if it has not been written successfully yet.
+     */
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> load() const override;
+
+    /**
+     * @copydoc SettingsPersistenceInterface::loadView
+     * @note Returns the view of the latest stored data if it has not been written successfully yet.
+     */
+    [[nodiscard]] std::optional<SettingsDataView> loadView() const override;
+
+    /**
+     * @copydoc SettingsPersistenceInterface::clear
+     */
+    [[nodiscard]] bool clear() override;
+
+    /**
+     * @brief Wait until all of the operations made so far have been written.
+     * @returns True if all of the writes since the previous flush succeeded, false otherwise.
+     * @examples
+     * WriteBehindSettingsPersistence persistence {getIface(...)};
+     * const auto result = persistence.store(data);
+     * const auto flushed = persistence.flush();
+     * @examples_end
+     */
+    [[nodiscard]] bool flush();
+
+    /**
+     * @brief Get the wrapped interface.
+     * @returns Interface specified in the constructor.
+     */
+    [[nodiscard]] const std::shared_ptr<SettingsPersistenceInterface> &getPersistenceApi() const;
+
+  private:
+    /**
+     * @brief Result of a write, shared by the operation and the queued operations that it superseded.
+     */
+    struct WriteResult {
+      std::optional<bool> m_success {};  ///< Set once the write has finished.
+    };
+
+    /**
+     * @brief A queued store or clear operation.
+     */
+    struct Operation {
+      std::uint64_t m_sequence;  ///< Number of the operation, increasing with every store or clear.
+      std::optional<std::vector<std::uint8_t>> m_data;  ///< Data to be stored, empty optional for the clear operation.
+      std::shared_ptr<WriteResult> m_result;  ///< Result to be reported to the waiting callers (durability mode only).
+    };
+
+    /**
+     * @brief Queue the operation and wait for it according to the policy.
+     */
+    [[nodiscard]] bool enqueue(std::optional<std::vector<std::uint8_t>> data);
+
+    /**
+     * @brief Forward the operation to the wrapped interface.
+     */
+    [[nodiscard]] bool write(const Operation &operation) const;
+
+    void runWorkerLoop();
+
+    std::shared_ptr<SettingsPersistenceInterface> m_persistence_api;  ///< Interface to forward the operations to.
+    Policy m_policy;  ///< When the store and clear operations return.
+    std::shared_ptr<const Operation> m_latest {};  ///< Latest operation, until it is written successfully (or fails in the durability mode).
+    std::shared_ptr<const Operation> m_pending {};  ///< Operation waiting to be picked up by the thread.
+    std::uint64_t m_next_sequence {1};  ///< Number to be assigned for the next operation.
+    std::uint64_t m_written_sequence {0};  ///< Number of the last operation that was written.
+    bool m_failed {false};  ///< Whether any of the writes failed since the previous flush.
+
+    mutable std::mutex m_mutex {};  ///< A mutex for synchronizing the thread and "external" access.
+    std::condition_variable m_pending_cv {};  ///< Condition variable for waking up the thread.
+    std::condition_variable m_written_cv {};  ///< Condition variable for signaling the finished writes.
+    bool m_keep_alive {true};  ///< When set to false, the thread will exit once the queued operation is written.
+
+    // Always the last in the list so that all the members are already initialized!
+    std::thread m_thread; /* NOSONAR(cpp:S6168): std::jthread is unavailable on the macOS libc++ used by CI. */  ///< Thread for writing the data.
+  };
+}  // namespace display_device
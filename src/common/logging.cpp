@@ -10,16 +10,35 @@
 #include "display_device/logging.h"
 
 // system includes
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <ctime>
 #include <exception>
 #include <format>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <mutex>
-#include <sstream>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+// local includes
+#include "display_device/mpsc_ring_buffer.h"
+#include "display_device/trace_sink.h"
 
 namespace display_device {
   namespace {
+    std::mutex output_mutex;  // NOSONAR(cpp:S5421): Guards the standard output for all of the threads.
+
     std::tm threadSafeLocaltime(const std::time_t &time) {
 #if defined(_MSC_VER)  // MSVCRT (2005+): std::localtime is threadsafe
       if (const auto tm_ptr {std::localtime(&time)}; tm_ptr) {
@@ -36,102 +55,935 @@ namespace display_device {
       std::cerr << "Exception thrown while writing a log message. Error:\n"
                 << error.what() << '\n';
     }
+
+    /**
+     * @brief Per-thread timestamp prefix that is only reformatted once the second changes.
+     */
+    struct TimestampCache {
+      std::optional<Logger::TimestampFormat> m_format {};  ///< Format of the cached prefix.
+      std::chrono::seconds m_second {};  ///< Second of the cached prefix.
+      std::string m_prefix {};  ///< Formatted prefix with placeholder milliseconds.
+      std::size_t m_millisecond_offset {};  ///< Position of the millisecond digits in the prefix.
+    };
+
+    void formatTimestamp(TimestampCache &cache, const Logger::TimestampFormat format, const std::chrono::seconds second) {
+      using enum Logger::TimestampFormat;
+      auto &prefix {cache.m_prefix};
+      prefix.clear();
+
+      switch (format) {  // GCOVR_EXCL_BR_LINE for when there is no case match...
+        case LocalTime:
+          {
+            const auto localtime {threadSafeLocaltime(static_cast<std::time_t>(second.count()))};
+            std::format_to(
+              std::back_inserter(prefix),
+              "[{:04}-{:02}-{:02} {:02}:{:02}:{:02}.",
+              localtime.tm_year + 1900,
+              localtime.tm_mon + 1,
+              localtime.tm_mday,
+              localtime.tm_hour,
+              localtime.tm_min,
+              localtime.tm_sec
+            );
+            cache.m_millisecond_offset = prefix.size();
+            prefix += "000] ";
+            break;
+          }
+        case UtcIso8601:
+          {
+            // Plain calendar arithmetic, no timezone database is involved
+            const std::chrono::sys_seconds time {second};
+            const auto day {std::chrono::floor<std::chrono::days>(time)};
+            const std::chrono::year_month_day date {day};
+            const std::chrono::hh_mm_ss time_of_day {time - day};
+            std::format_to(
+              std::back_inserter(prefix),
+              "[{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.",
+              static_cast<int>(date.year()),
+              static_cast<unsigned>(date.month()),
+              static_cast<unsigned>(date.day()),
+              time_of_day.hours().count(),
+              time_of_day.minutes().count(),
+              time_of_day.seconds().count()
+            );
+            cache.m_millisecond_offset = prefix.size();
+            prefix += "000Z] ";
+            break;
+          }
+        case Monotonic:
+          std::format_to(std::back_inserter(prefix), "[{}.", second.count());
+          cache.m_millisecond_offset = prefix.size();
+          prefix += "000] ";
+          break;
+      }
+
+      cache.m_format = format;
+      cache.m_second = second;
+    }
+
+    void appendTimestamp(std::string &line, const Logger::TimestampFormat format, const std::chrono::nanoseconds since_epoch) {
+      thread_local TimestampCache cache;
+
+      const auto second {std::chrono::floor<std::chrono::seconds>(since_epoch)};
+      if (cache.m_format != format || cache.m_second != second) {
+        formatTimestamp(cache, format, second);
+      }
+
+      // Only the milliseconds need to be patched in
+      const auto milliseconds {static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(since_epoch - second).count())};
+      auto &prefix {cache.m_prefix};
+      prefix[cache.m_millisecond_offset] = static_cast<char>('0' + milliseconds / 100);
+      prefix[cache.m_millisecond_offset + 1] = static_cast<char>('0' + milliseconds / 10 % 10);
+      prefix[cache.m_millisecond_offset + 2] = static_cast<char>('0' + milliseconds % 10);
+      line += prefix;
+    }
+
+    std::string_view getLevelLabel(const Logger::LogLevel log_level) {
+      switch (log_level) {  // GCOVR_EXCL_BR_LINE for when there is no case match...
+        using enum Logger::LogLevel;
+
+        case verbose:
+          return "VERBOSE: ";
+        case debug:
+          return "DEBUG:   ";
+        case info:
+          return "INFO:    ";
+        case warning:
+          return "WARNING: ";
+        case error:
+          return "ERROR:   ";
+        case fatal:
+          return "FATAL:   ";
+      }
+      return {};  // GCOVR_EXCL_LINE
+    }
+
+    /**
+     * @brief Keeps the reader registered in the sink epoch for as long as it is alive.
+     */
+    class SinkReaderGuard {
+    public:
+      explicit SinkReaderGuard(std::atomic<std::uint64_t> &readers):
+          m_readers {readers} {
+        m_readers.fetch_add(1);
+      }
+
+      SinkReaderGuard(const SinkReaderGuard &) = delete;
+      SinkReaderGuard &operator=(const SinkReaderGuard &) = delete;
+
+      ~SinkReaderGuard() {
+        m_readers.fetch_sub(1);
+      }
+
+    private:
+      std::atomic<std::uint64_t> &m_readers;
+    };
+
+    void appendFields(std::string &output, const std::span<const Logger::Field> fields) {
+      for (const auto &field : fields) {
+        std::format_to(std::back_inserter(output), " {}=", field.m_key);
+        std::visit([&output](const auto &value) {
+          using ValueT = std::decay_t<decltype(value)>;
+          if constexpr (std::is_same_v<ValueT, std::string>) {
+            std::format_to(std::back_inserter(output), "\"{}\"", value);
+          } else {
+            std::format_to(std::back_inserter(output), "{}", value);
+          }
+        },
+                   field.m_value);
+      }
+    }
+
+    void flushOutput() {
+      std::lock_guard lock {output_mutex};
+      std::cout.flush();
+    }
+
+    thread_local bool in_batch_callback {false};  ///< Whether the thread is currently invoking the batch callback.
+    thread_local std::string format_buffer;  ///< Buffer shared by all the formatted records of the thread.
+    thread_local bool format_buffer_leased {false};  ///< Whether the format buffer is currently in use.
   }  // namespace
 
+  namespace detail {
+    FormatBufferLease acquireFormatBuffer() {
+      // A nested call (e.g. from a formatter or the callback) must not reuse the buffer that is still being used.
+      if (format_buffer_leased) {
+        return FormatBufferLease {nullptr};
+      }
+
+      format_buffer_leased = true;
+      return FormatBufferLease {&format_buffer};
+    }
+
+    FormatBufferLease::FormatBufferLease(std::string *buffer):
+        m_buffer {buffer} {
+    }
+
+    FormatBufferLease::~FormatBufferLease() {
+      if (m_buffer) {
+        format_buffer_leased = false;
+      }
+    }
+
+    std::string &FormatBufferLease::get() const {
+      return m_buffer ? *m_buffer : m_own_buffer;
+    }
+  }  // namespace detail
+
+  /**
+   * @brief Background thread draining the lock-free queue of records.
+   */
+  class Logger::AsyncWorker final {
+  public:
+    /**
+     * @brief Record waiting to be written.
+     */
+    struct QueuedRecord {
+      LogCategory m_category {};  ///< Category of the record.
+      LogLevel m_log_level {};  ///< Log level of the record.
+      Timestamp m_timestamp {};  ///< Time at which the record was created.
+      std::string m_value {};  ///< String to be written.
+      std::vector<Field> m_fields {};  ///< Structured fields of the record.
+    };
+
+    AsyncWorker(const Logger &logger, const AsyncOptions &options):
+        m_logger {logger},
+        m_full_policy {options.m_full_policy},
+        m_buffer {options.m_capacity},
+        m_thread {[this]() {
+          run();
+        }} {
+    }
+
+    AsyncWorker(const AsyncWorker &) = delete;
+    AsyncWorker &operator=(const AsyncWorker &) = delete;
+
+    ~AsyncWorker() {
+      m_keep_alive.store(false, std::memory_order_release);
+      m_pushed.fetch_add(1, std::memory_order_release);
+      m_pushed.notify_one();
+      m_thread.join();
+    }
+
+    [[nodiscard]] bool isWorkerThread() const {
+      return std::this_thread::get_id() == m_thread.get_id();
+    }
+
+    /**
+     * @brief Queue the record unless that requires waiting.
+     * @returns True if the record was handled (queued or dropped), false if it has to be passed to `push` instead.
+     */
+    bool tryPush(QueuedRecord &record) {
+      // The fatal records are waited for until they are written out.
+      if (record.m_log_level == LogLevel::fatal) {
+        return false;
+      }
+
+      if (!m_buffer.tryPush(std::move(record))) {
+        if (m_full_policy == AsyncFullPolicy::Drop) {
+          m_dropped.fetch_add(1, std::memory_order_relaxed);
+          return true;
+        }
+        return false;
+      }
+
+      m_pushed.fetch_add(1, std::memory_order_release);
+      m_pushed.notify_one();
+      return true;
+    }
+
+    void push(QueuedRecord record) {
+      const bool is_fatal {record.m_log_level == LogLevel::fatal};
+      while (!m_buffer.tryPush(std::move(record))) {
+        if (m_full_policy == AsyncFullPolicy::Drop && !is_fatal) {
+          m_dropped.fetch_add(1, std::memory_order_relaxed);
+          return;
+        }
+
+        // Check once more after taking the snapshot, otherwise the notification could be missed.
+        const auto consumed {m_consumed.load(std::memory_order_acquire)};
+        if (m_buffer.tryPush(std::move(record))) {
+          break;
+        }
+        m_consumed.wait(consumed, std::memory_order_acquire);
+      }
+
+      m_pushed.fetch_add(1, std::memory_order_release);
+      m_pushed.notify_one();
+
+      if (is_fatal) {
+        flush();
+      }
+    }
+
+    void flush() const {
+      const auto target {m_pushed.load(std::memory_order_acquire)};
+      auto consumed {m_consumed.load(std::memory_order_acquire)};
+      while (consumed < target) {
+        m_consumed.wait(consumed, std::memory_order_acquire);
+        consumed = m_consumed.load(std::memory_order_acquire);
+      }
+    }
+
+    [[nodiscard]] std::uint64_t getDroppedCount() const {
+      return m_dropped.load(std::memory_order_relaxed);
+    }
+
+  private:
+    void run() {
+      while (true) {
+        const auto pushed {m_pushed.load(std::memory_order_acquire)};
+        drain();
+
+        if (!m_keep_alive.load(std::memory_order_acquire)) {
+          // Pick up whatever was pushed while we were being stopped.
+          drain();
+          break;
+        }
+        m_pushed.wait(pushed, std::memory_order_acquire);
+      }
+
+      // Release anyone still waiting for us.
+      m_consumed.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_release);
+      m_consumed.notify_all();
+    }
+
+    void drain() {
+      bool written {false};
+      while (auto record {m_buffer.tryPop()}) {
+        try {
+          const bool is_fatal {record->m_log_level == LogLevel::fatal};
+          m_logger.writeRecord(record->m_category, record->m_log_level, record->m_timestamp, record->m_value, record->m_fields, is_fatal);
+        } catch (const std::exception &error) {
+          reportLogWriterException(error);
+        }
+
+        written = true;
+        m_consumed.fetch_add(1, std::memory_order_release);
+        m_consumed.notify_all();
+      }
+
+      // Flush once per batch instead of once per record.
+      if (written) {
+        flushOutput();
+      }
+    }
+
+    const Logger &m_logger;  ///< Logger to write the records with.
+    AsyncFullPolicy m_full_policy;  ///< What to do when the queue is full.
+    MpscRingBuffer<QueuedRecord> m_buffer;  ///< Queued records.
+    std::atomic<std::uint64_t> m_pushed {0};  ///< Number of the pushed records (also used for waking up the thread).
+    std::atomic<std::uint64_t> m_consumed {0};  ///< Number of the written records.
+    std::atomic<std::uint64_t> m_dropped {0};  ///< Number of the dropped records.
+    std::atomic_bool m_keep_alive {true};  ///< When set to false, the thread will exit once the queue is drained.
+
+    // Always the last in the list so that all the members are already initialized!
+    std::thread m_thread; /* NOSONAR(cpp:S6168): std::jthread is unavailable on the macOS libc++ used by CI. */  ///< Background thread.
+  };
+
+  /**
+   * @brief Background thread collecting the records for the batch callback.
+   */
+  class Logger::Batcher final {
+  public:
+    Batcher(BatchCallback callback, const BatchOptions &options):
+        m_callback {std::move(callback)},
+        m_options {options},
+        m_thread {[this]() {
+          run();
+        }} {
+    }
+
+    Batcher(const Batcher &) = delete;
+    Batcher &operator=(const Batcher &) = delete;
+
+    ~Batcher() {
+      {
+        std::lock_guard lock {m_mutex};
+        m_keep_alive = false;
+      }
+      m_cv.notify_one();
+      m_thread.join();
+    }
+
+    void push(BatchRecord record) {
+      bool wake_up {false};
+      {
+        std::lock_guard lock {m_mutex};
+        if (m_pending.empty()) {
+          // The idle thread waits without a timeout, so it has to be woken up to start waiting for the deadline.
+          m_deadline = std::chrono::steady_clock::now() + m_options.m_flush_interval;
+          wake_up = true;
+        }
+        m_pending_bytes += record.m_text.size();
+        m_pending.push_back(std::move(record));
+        wake_up = wake_up || isFullUnlocked();
+      }
+
+      // The delivery is left to the background thread, so that the logging thread does not wait for the callback.
+      if (wake_up) {
+        m_cv.notify_one();
+      }
+    }
+
+    void flush() {
+      // Records logged from within the callback are delivered with the next batch to avoid a deadlock.
+      if (in_batch_callback) {
+        return;
+      }
+      deliver();
+    }
+
+  private:
+    [[nodiscard]] bool isFullUnlocked() const {
+      return m_pending.size() >= m_options.m_max_records || m_pending_bytes >= m_options.m_max_bytes;
+    }
+
+    void run() {
+      std::unique_lock lock {m_mutex};
+      while (m_keep_alive) {
+        if (m_pending.empty()) {
+          m_cv.wait(lock);
+        } else if (isFullUnlocked() || std::chrono::steady_clock::now() >= m_deadline) {
+          lock.unlock();
+          deliver();
+          lock.lock();
+        } else {
+          m_cv.wait_until(lock, m_deadline);
+        }
+      }
+
+      // Deliver whatever was pushed while we were being stopped.
+      lock.unlock();
+      deliver();
+    }
+
+    void deliver() {
+      // Keeps the batches in order when they are delivered from multiple threads.
+      std::lock_guard delivery_lock {m_delivery_mutex};
+      {
+        std::lock_guard lock {m_mutex};
+        // Swapping the buffers keeps both of their capacities, so no allocation is needed once they have grown.
+        std::swap(m_pending, m_delivering);
+        m_pending_bytes = 0;
+      }
+
+      if (m_delivering.empty()) {
+        return;
+      }
+
+      in_batch_callback = true;
+      try {
+        m_callback(m_delivering);
+      } catch (const std::exception &error) {
+        reportLogWriterException(error);
+      }
+      in_batch_callback = false;
+      m_delivering.clear();
+    }
+
+    BatchCallback m_callback;  ///< Callback to deliver the records to.
+    BatchOptions m_options;  ///< Delivery thresholds.
+    std::vector<BatchRecord> m_pending;  ///< Records waiting for the delivery.
+    std::size_t m_pending_bytes {0};  ///< Total text size of the pending records.
+    std::chrono::steady_clock::time_point m_deadline {};  ///< Time at which the pending records are to be delivered.
+    std::vector<BatchRecord> m_delivering;  ///< Records currently being delivered.
+
+    std::mutex m_mutex {};  ///< Guards the pending records.
+    std::mutex m_delivery_mutex {};  ///< Serializes the callback invocations.
+    std::condition_variable m_cv {};  ///< Condition variable for waking up the thread.
+    bool m_keep_alive {true};  ///< When set to false, the thread will exit once the records are delivered.
+
+    // Always the last in the list so that all the members are already initialized!
+    std::thread m_thread; /* NOSONAR(cpp:S6168): std::jthread is unavailable on the macOS libc++ used by CI. */  ///< Background thread.
+  };
+
+  /**
+   * @brief Collapses the identical consecutive records.
+   */
+  class Logger::Deduplicator final {
+  public:
+    /**
+     * @brief Record summarizing the suppressed duplicates.
+     */
+    struct Summary {
+      LogCategory m_category;  ///< Category of the duplicates.
+      LogLevel m_log_level;  ///< Log level of the duplicates.
+      Timestamp m_timestamp;  ///< Time of the last duplicate.
+      std::string m_message;  ///< Summary text.
+    };
+
+    /**
+     * @brief Result of the duplicate check.
+     */
+    struct Result {
+      bool m_is_duplicate;  ///< Whether the record is to be suppressed.
+      std::optional<Summary> m_summary;  ///< Summary to be written before the record (if any).
+    };
+
+    void reset(const std::chrono::milliseconds summary_interval) {
+      std::lock_guard lock {m_mutex};
+      m_summary_interval = summary_interval;
+      m_last = std::nullopt;
+      m_repeated = 0;
+    }
+
+    Result check(const LogCategory category, const LogLevel log_level, const Timestamp timestamp, const std::string_view message, const std::span<const Field> fields) {
+      std::lock_guard lock {m_mutex};
+      const auto now {std::chrono::steady_clock::now()};
+
+      if (isSameAsLastUnlocked(category, log_level, message, fields)) {
+        m_repeated++;
+        m_last_timestamp = timestamp;
+
+        // Let the reader know that we are still repeating
+        std::optional<Summary> summary;
+        if (now - m_summary_start >= m_summary_interval) {
+          summary = takeSummaryUnlocked();
+          m_summary_start = now;
+        }
+        return {.m_is_duplicate = true, .m_summary = std::move(summary)};
+      }
+
+      auto summary {takeSummaryUnlocked()};
+      m_last = Last {.m_category = category, .m_log_level = log_level, .m_message = std::string {message}, .m_fields = {std::begin(fields), std::end(fields)}};
+      m_last_timestamp = timestamp;
+      m_summary_start = now;
+      return {.m_is_duplicate = false, .m_summary = std::move(summary)};
+    }
+
+    std::optional<Summary> takeSummary() {
+      std::lock_guard lock {m_mutex};
+      return takeSummaryUnlocked();
+    }
+
+  private:
+    /**
+     * @brief The last non-duplicate record.
+     */
+    struct Last {
+      LogCategory m_category;  ///< Category of the record.
+      LogLevel m_log_level;  ///< Log level of the record.
+      std::string m_message;  ///< Message of the record.
+      std::vector<Field> m_fields;  ///< Structured fields of the record.
+    };
+
+    [[nodiscard]] bool isSameAsLastUnlocked(const LogCategory category, const LogLevel log_level, const std::string_view message, const std::span<const Field> fields) const {
+      return m_last &&
+             m_last->m_category == category &&
+             m_last->m_log_level == log_level &&
+             m_last->m_message == message &&
+             std::ranges::equal(m_last->m_fields, fields, [](const Field &lhs, const Field &rhs) {
+               return lhs.m_key == rhs.m_key && lhs.m_value == rhs.m_value;
+             });
+    }
+
+    std::optional<Summary> takeSummaryUnlocked() {
+      if (!m_last || m_repeated == 0) {
+        return std::nullopt;
+      }
+
+      const auto repeated {std::exchange(m_repeated, 0)};
+      return Summary {
+        .m_category = m_last->m_category,
+        .m_log_level = m_last->m_log_level,
+        .m_timestamp = m_last_timestamp,
+        .m_message = std::format("Previous message repeated {} time(s).", repeated)
+      };
+    }
+
+    std::mutex m_mutex;  ///< Serializes the checks.
+    std::chrono::milliseconds m_summary_interval {std::chrono::minutes {1}};  ///< How often the summary is written while repeating.
+    std::optional<Last> m_last;  ///< The last non-duplicate record.
+    Timestamp m_last_timestamp {};  ///< Time of the last (possibly duplicate) record.
+    std::uint64_t m_repeated {0};  ///< Number of the suppressed duplicates since the last summary.
+    std::chrono::steady_clock::time_point m_summary_start {};  ///< Time since which the duplicates are being counted.
+  };
+
   Logger &Logger::get() {
     static Logger instance;  // GCOVR_EXCL_BR_LINE for some reason...
     return instance;
   }
 
   void Logger::setLogLevel(const LogLevel log_level) {
-    m_enabled_log_level = log_level;
+    m_enabled_log_level.store(log_level, std::memory_order_relaxed);
+  }
+
+  void Logger::setLogLevel(const LogCategory category, const LogLevel log_level) {
+    m_category_log_levels[static_cast<std::size_t>(category)].store(static_cast<int>(log_level), std::memory_order_relaxed);
   }
 
-  bool Logger::isLogLevelEnabled(LogLevel log_level) const {
-    const auto log_level_v {static_cast<std::underlying_type_t<LogLevel>>(log_level)};
-    const auto enabled_log_level_v {static_cast<std::underlying_type_t<LogLevel>>(m_enabled_log_level)};
-    return log_level_v >= enabled_log_level_v;
+  void Logger::resetLogLevel(const LogCategory category) {
+    m_category_log_levels[static_cast<std::size_t>(category)].store(-1, std::memory_order_relaxed);
+  }
+
+  bool Logger::isLogLevelEnabled(const LogLevel log_level) const {
+    return isLogLevelEnabled(LogCategory::general, log_level);
+  }
+
+  bool Logger::isLogLevelEnabled(const LogCategory category, const LogLevel log_level) const {
+    auto enabled_log_level_v {m_category_log_levels[static_cast<std::size_t>(category)].load(std::memory_order_relaxed)};
+    if (enabled_log_level_v < 0) {
+      enabled_log_level_v = static_cast<int>(m_enabled_log_level.load(std::memory_order_relaxed));
+    }
+    return static_cast<int>(log_level) >= enabled_log_level_v;
+  }
+
+  void Logger::setTimestampFormat(const TimestampFormat format) {
+    m_timestamp_format.store(format, std::memory_order_relaxed);
   }
 
   void Logger::setCustomCallback(Callback callback) {
-    m_custom_callback = std::move(callback);
+    updateSinks([&callback](Sinks &sinks) {
+      sinks.m_callback = std::move(callback);
+    });
+  }
+
+  void Logger::setRecordCallback(RecordCallback callback) {
+    updateSinks([&callback](Sinks &sinks) {
+      sinks.m_record_callback = std::move(callback);
+    });
+  }
+
+  void Logger::setBatchCallback(BatchCallback callback, const BatchOptions &options) {
+    std::shared_ptr<Batcher> batcher;
+    if (callback) {
+      if (options.m_max_records == 0) {
+        throw std::invalid_argument {"Max records specified in BatchOptions must be larger than 0!"};
+      }
+      if (options.m_flush_interval <= std::chrono::milliseconds::zero()) {
+        throw std::invalid_argument {"Flush interval specified in BatchOptions must be positive!"};
+      }
+      batcher = std::make_shared<Batcher>(std::move(callback), options);
+    }
+
+    // The previous batcher delivers its pending records once the grace period is over.
+    updateSinks([&batcher](Sinks &sinks) {
+      sinks.m_batcher = std::move(batcher);
+    });
+  }
+
+  void Logger::setTraceSink(std::shared_ptr<TraceSink> sink) {
+    const bool enabled {sink != nullptr};
+    updateSinks([&sink](Sinks &sinks) {
+      sinks.m_trace_sink = std::move(sink);
+    });
+    m_trace_enabled.store(enabled, std::memory_order_relaxed);
+  }
+
+  bool Logger::isTraceEnabled() const {
+    return m_trace_enabled.load(std::memory_order_relaxed);
+  }
+
+  void Logger::writeTrace(const TraceFormat &format, const TraceArguments &arguments) const {
+    const SinkReaderGuard guard {m_sink_readers[m_sink_epoch.load() % 2]};
+    if (const auto *sinks {m_sinks.load()}; sinks && sinks->m_trace_sink) {
+      sinks->m_trace_sink->write(format, arguments);
+    }
+  }
+
+  void Logger::write(const LogLevel log_level, const std::string_view value) const {
+    writeChecked(LogCategory::general, log_level, value, {});
+  }
+
+  void Logger::write(const LogCategory category, const LogLevel log_level, const std::string_view value) const {
+    writeChecked(category, log_level, value, {});
   }
 
-  void Logger::write(const LogLevel log_level, std::string value) const {
-    if (!isLogLevelEnabled(log_level)) {
+  void Logger::writeFields(const LogCategory category, const LogLevel log_level, const std::string_view message, const std::initializer_list<Field> fields) const {
+    writeChecked(category, log_level, message, fields);
+  }
+
+  void Logger::enableAsyncMode(const AsyncOptions &options) {
+    // The new worker is created first, so that the current mode is kept if the options are invalid.
+    auto worker {std::make_shared<AsyncWorker>(*this, options)};
+    // The previous worker writes out its pending records once the grace period is over.
+    updateSinks([&worker](Sinks &sinks) {
+      sinks.m_async_worker = std::move(worker);
+    });
+  }
+
+  void Logger::disableAsyncMode() {
+    updateSinks([](Sinks &sinks) {
+      sinks.m_async_worker.reset();
+    });
+  }
+
+  void Logger::flush() const {
+    std::shared_ptr<AsyncWorker> worker;
+    {
+      const SinkReaderGuard guard {m_sink_readers[m_sink_epoch.load() % 2]};
+      if (const auto *sinks {m_sinks.load()}; sinks) {
+        worker = sinks->m_async_worker;
+      }
+    }
+
+    if (worker) {
+      worker->flush();
+      flushOutput();
+    }
+    writeDeduplicationSummary();
+
+    const SinkReaderGuard guard {m_sink_readers[m_sink_epoch.load() % 2]};
+    if (const auto *sinks {m_sinks.load()}; sinks && sinks->m_batcher) {
+      sinks->m_batcher->flush();
+    }
+  }
+
+  void Logger::enableDeduplication(const std::chrono::milliseconds summary_interval) {
+    // Write out the summary from the previous configuration (if any) before starting over.
+    writeDeduplicationSummary();
+    m_deduplicator->reset(summary_interval);
+    m_deduplicate.store(true, std::memory_order_relaxed);
+  }
+
+  void Logger::disableDeduplication() {
+    m_deduplicate.store(false, std::memory_order_relaxed);
+    flush();
+  }
+
+  std::uint64_t Logger::getDroppedCount() const {
+    const SinkReaderGuard guard {m_sink_readers[m_sink_epoch.load() % 2]};
+    const auto *sinks {m_sinks.load()};
+    return sinks && sinks->m_async_worker ? sinks->m_async_worker->getDroppedCount() : 0;
+  }
+
+  void Logger::updateSinks(const std::function<void(Sinks &)> &update) {
+    // Destroyed after the lock is released, since the previous asynchronous worker writes out its
+    // pending records on destruction and their callbacks are free to replace the sinks again.
+    std::unique_ptr<const Sinks> old_sinks;
+
+    std::lock_guard lock {m_sink_mutex};
+
+    const auto *current_sinks {m_sinks.load()};
+    auto new_sinks {current_sinks ? std::make_unique<Sinks>(*current_sinks) : std::make_unique<Sinks>()};
+    update(*new_sinks);
+    if (!new_sinks->m_callback && !new_sinks->m_record_callback && !new_sinks->m_batcher && !new_sinks->m_trace_sink && !new_sinks->m_async_worker) {
+      new_sinks.reset();
+    }
+
+    old_sinks.reset(m_sinks.exchange(new_sinks.release()));
+    if (!old_sinks) {
       return;
     }
 
-    if (m_custom_callback) {
-      m_custom_callback(log_level, std::move(value));
+    // Grace period - the epoch is flipped twice, because a reader might have registered in the
+    // previous epoch just before the first flip and still be holding the old sinks.
+    for (int i {0}; i < 2; ++i) {
+      const auto epoch {m_sink_epoch.fetch_add(1)};
+      while (m_sink_readers[epoch % 2].load() != 0) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void Logger::writeChecked(const LogCategory category, const LogLevel log_level, const std::string_view message, const std::span<const Field> fields) const {
+    if (!isLogLevelEnabled(category, log_level)) {
       return;
     }
 
-    std::stringstream stream;
+    const auto timestamp {now()};
+    std::shared_ptr<AsyncWorker> waiting_worker;
+    std::optional<AsyncWorker::QueuedRecord> waiting_record;
     {
-      // Time (limited by GCC 10, so it's not pretty...)
-      {
-        const auto now {std::chrono::system_clock::now()};
-        const auto now_ms {std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch())};
-        const auto now_s {std::chrono::duration_cast<std::chrono::seconds>(now_ms)};
-
-        const std::time_t time {std::chrono::system_clock::to_time_t(now)};
-        const auto localtime {threadSafeLocaltime(time)};
-        const auto now_decimal_part {now_ms - now_s};
-
-        stream << std::format(
-          "[{:04}-{:02}-{:02} {:02}:{:02}:{:02}.{:03}] ",
-          localtime.tm_year + 1900,
-          localtime.tm_mon + 1,
-          localtime.tm_mday,
-          localtime.tm_hour,
-          localtime.tm_min,
-          localtime.tm_sec,
-          now_decimal_part.count()
-        );
-      }
-
-      // Log level
-      switch (log_level) {  // GCOVR_EXCL_BR_LINE for when there is no case match...
-        using enum LogLevel;
+      const SinkReaderGuard guard {m_sink_readers[m_sink_epoch.load() % 2]};
+      // Records logged from within the background thread (e.g. by the callback) are written directly to avoid a deadlock.
+      if (const auto *sinks {m_sinks.load()}; sinks && sinks->m_async_worker && !sinks->m_async_worker->isWorkerThread()) {
+        AsyncWorker::QueuedRecord record {.m_category = category, .m_log_level = log_level, .m_timestamp = timestamp, .m_value = std::string {message}, .m_fields = {std::begin(fields), std::end(fields)}};
+        if (sinks->m_async_worker->tryPush(record)) {
+          return;
+        }
 
-        case verbose:
-          stream << "VERBOSE: ";
-          break;
-        case debug:
-          stream << "DEBUG:   ";
-          break;
-        case info:
-          stream << "INFO:    ";
-          break;
-        case warning:
-          stream << "WARNING: ";
-          break;
-        case error:
-          stream << "ERROR:   ";
-          break;
-        case fatal:
-          stream << "FATAL:   ";
-          break;
+        // The waiting is done outside the guard, otherwise the sink updates would be held up by it.
+        waiting_worker = sinks->m_async_worker;
+        waiting_record = std::move(record);
       }
+    }
+
+    if (waiting_worker) {
+      waiting_worker->push(std::move(*waiting_record));
+      return;
+    }
+
+    writeRecord(category, log_level, timestamp, message, fields, true);
+  }
+
+  Logger::Timestamp Logger::now() const {
+    const auto format {m_timestamp_format.load(std::memory_order_relaxed)};
+    if (format == TimestampFormat::Monotonic) {
+      return {.m_format = format, .m_since_epoch = std::chrono::steady_clock::now().time_since_epoch()};
+    }
+    return {.m_format = format, .m_since_epoch = std::chrono::system_clock::now().time_since_epoch()};
+  }
 
-      // Value
-      stream << value;
+  void Logger::writeRecord(const LogCategory category, const LogLevel log_level, const Timestamp timestamp, const std::string_view message, const std::span<const Field> fields, const bool flush_output) const {
+    if (m_deduplicate.load(std::memory_order_relaxed)) {
+      const auto result {m_deduplicator->check(category, log_level, timestamp, message, fields)};
+      if (result.m_summary) {
+        const auto &summary {*result.m_summary};
+        deliverRecord(summary.m_category, summary.m_log_level, summary.m_timestamp, summary.m_message, {}, flush_output);
+      }
+      if (result.m_is_duplicate) {
+        return;
+      }
     }
 
-    static std::mutex log_mutex;
-    std::lock_guard lock {log_mutex};
-    std::cout << stream.rdbuf() << std::endl;
+    deliverRecord(category, log_level, timestamp, message, fields, flush_output);
   }
 
-  Logger::Logger() = default;
+  void Logger::writeDeduplicationSummary() const {
+    if (const auto summary {m_deduplicator->takeSummary()}; summary) {
+      deliverRecord(summary->m_category, summary->m_log_level, summary->m_timestamp, summary->m_message, {}, true);
+    }
+  }
+
+  void Logger::deliverRecord(const LogCategory category, const LogLevel log_level, const Timestamp timestamp, const std::string_view message, const std::span<const Field> fields, const bool flush_output) const {
+    {
+      const SinkReaderGuard guard {m_sink_readers[m_sink_epoch.load() % 2]};
+      if (const auto *sinks {m_sinks.load()}; sinks && (sinks->m_callback || sinks->m_record_callback || sinks->m_batcher)) {
+        if (sinks->m_record_callback) {
+          sinks->m_record_callback({.m_category = category, .m_level = log_level, .m_message = message, .m_fields = fields});
+          return;
+        }
+
+        if (sinks->m_batcher) {
+          BatchRecord record {.m_category = category, .m_level = log_level, .m_timestamp = timestamp.m_since_epoch, .m_text = std::string {message}};
+          appendFields(record.m_text, fields);
+          sinks->m_batcher->push(std::move(record));
+          if (log_level == LogLevel::fatal) {
+            sinks->m_batcher->flush();
+          }
+          return;
+        }
+
+        if (fields.empty()) {
+          sinks->m_callback(log_level, message);
+        } else {
+          std::string text {message};
+          appendFields(text, fields);
+          sinks->m_callback(log_level, text);
+        }
+        return;
+      }
+    }
+
+    // Reused by the thread to avoid allocating for every line
+    thread_local std::string line;
+    line.clear();
+    appendTimestamp(line, timestamp.m_format, timestamp.m_since_epoch);
+    line += getLevelLabel(log_level);
+    line += message;
+    appendFields(line, fields);
+    line += '\n';
+
+    std::lock_guard lock {output_mutex};
+    std::cout.write(line.data(), static_cast<std::streamsize>(line.size()));
+    if (flush_output) {
+      std::cout.flush();
+    }
+  }
+
+  Logger::Logger():
+      m_deduplicator {std::make_unique<Deduplicator>()} {
+    for (auto &category_log_level : m_category_log_levels) {
+      category_log_level.store(-1, std::memory_order_relaxed);
+    }
+  }
+
+  Logger::~Logger() {
+    // The pending asynchronous records still need the callback.
+    disableAsyncMode();
+    const std::unique_ptr<const Sinks> sinks {m_sinks.exchange(nullptr)};
+  }
+
+  bool LogEveryN::shouldLog(const std::uint64_t n) {
+    return n <= 1 || m_counter.fetch_add(1, std::memory_order_relaxed) % n == 0;
+  }
+
+  bool LogOncePer::shouldLog(const std::chrono::steady_clock::duration interval) {
+    const auto now {std::chrono::steady_clock::now().time_since_epoch().count()};
+    auto next_allowed {m_next_allowed.load(std::memory_order_relaxed)};
+    if (now < next_allowed) {
+      return false;
+    }
+
+    // Only one of the racing threads gets to log
+    return m_next_allowed.compare_exchange_strong(next_allowed, now + interval.count(), std::memory_order_relaxed);
+  }
+
+  LogRepeatLimiter::LogRepeatLimiter(const std::chrono::steady_clock::duration interval):
+      m_interval {interval} {}
+
+  LogRepeatLimiter::~LogRepeatLimiter() noexcept {
+    try {
+      for (const auto &[message, entry] : m_entries) {
+        if (entry.m_suppressed > 0) {
+          writeSummary(message, entry);
+        }
+      }
+    } catch (const std::exception &error) {
+      reportLogWriterException(error);
+    }
+  }
+
+  bool LogRepeatLimiter::shouldLog(const Logger::LogCategory category, const Logger::LogLevel log_level, const std::string_view message) {
+    std::vector<std::pair<std::string, Entry>> expired;
+    bool should_log {true};
+    {
+      std::lock_guard lock {m_mutex};
+      const auto now {std::chrono::steady_clock::now()};
+      for (auto it {std::begin(m_entries)}; it != std::end(m_entries);) {
+        if (now < it->second.m_interval_end) {
+          ++it;
+          continue;
+        }
+
+        if (it->second.m_suppressed > 0) {
+          expired.emplace_back(it->first, it->second);
+        }
+        it = m_entries.erase(it);
+      }
+
+      if (auto it {m_entries.find(message)}; it != std::end(m_entries)) {
+        it->second.m_suppressed++;
+        should_log = false;
+      } else {
+        m_entries.emplace(std::string {message}, Entry {category, log_level, now + m_interval, 0});
+      }
+    }
+
+    // Written outside the lock, since the callbacks might log via the same limiter.
+    for (const auto &[expired_message, entry] : expired) {
+      writeSummary(expired_message, entry);
+    }
+    return should_log;
+  }
+
+  void LogRepeatLimiter::writeSummary(const std::string_view message, const Entry &entry) {
+    const auto first_line {message.substr(0, message.find('\n'))};
+    Logger::get().write(entry.m_category, entry.m_log_level, std::format("Suppressed {} repeat(s) of the message: {}", entry.m_suppressed, first_line));
+  }
 
   LogWriter::LogWriter(const Logger::LogLevel log_level):
+      LogWriter(Logger::LogCategory::general, log_level) {}
+
+  LogWriter::LogWriter(const Logger::LogCategory category, const Logger::LogLevel log_level):
+      m_category {category},
       m_log_level {log_level} {}
 
+  LogWriter::LogWriter(const Logger::LogCategory category, const Logger::LogLevel log_level, LogRepeatLimiter &limiter):
+      m_category {category},
+      m_log_level {log_level},
+      m_limiter {&limiter} {}
+
   LogWriter::~LogWriter() noexcept {
     try {
-      Logger::get().write(m_log_level, m_buffer.str());
+      const auto message {m_buffer.str()};
+      if (m_limiter && !m_limiter->shouldLog(m_category, m_log_level, message)) {
+        return;
+      }
+
+      Logger::get().write(m_category, m_log_level, message);
     } catch (const std::exception &error) {
       reportLogWriterException(error);
     }
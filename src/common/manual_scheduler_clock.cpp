@@ -0,0 +1,70 @@
+/**
+ * @file src/common/manual_scheduler_clock.cpp
+ * @brief Definitions for the ManualSchedulerClock.
+ */
+// class header include
+#include "display_device/manual_scheduler_clock.h"
+
+// system includes
+#include <algorithm>
+
+namespace display_device {
+  ManualSchedulerClock::ManualSchedulerClock(const TimePoint start):
+      m_now {start} {
+  }
+
+  SchedulerClockInterface::TimePoint ManualSchedulerClock::now() const {
+    std::lock_guard lock {m_mutex};
+    return m_now;
+  }
+
+  void ManualSchedulerClock::sleepUntil(const TimePoint time_point) {
+    advanceTo(time_point);
+  }
+
+  void ManualSchedulerClock::waitUntil(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, const TimePoint time_point) {
+    {
+      std::lock_guard clock_lock {m_mutex};
+      if (m_now >= time_point) {
+        return;
+      }
+
+      // The caller's lock is held until the wait starts, therefore the notification
+      // from `advanceTo` (which locks the same mutex) cannot be lost.
+      m_waiters.push_back({.m_cv = &cv, .m_mutex = lock.mutex()});
+    }
+
+    cv.wait(lock);
+
+    std::lock_guard clock_lock {m_mutex};
+    const auto waiter_it {std::ranges::find_if(m_waiters, [&cv](const Waiter &waiter) {
+      return waiter.m_cv == &cv;
+    })};
+    if (waiter_it != std::end(m_waiters)) {
+      m_waiters.erase(waiter_it);
+    }
+  }
+
+  void ManualSchedulerClock::advance(const std::chrono::nanoseconds duration) {
+    advanceTo(now() + std::chrono::duration_cast<TimePoint::duration>(duration));
+  }
+
+  void ManualSchedulerClock::advanceTo(const TimePoint time_point) {
+    std::vector<Waiter> waiters;
+    {
+      std::lock_guard lock {m_mutex};
+      if (time_point <= m_now) {
+        return;
+      }
+
+      m_now = time_point;
+      waiters = m_waiters;
+    }
+
+    // Not holding the clock's lock here, since the waiters lock their own mutex before the clock's one.
+    for (const auto &waiter : waiters) {
+      std::lock_guard waiter_lock {*waiter.m_mutex};
+      waiter.m_cv->notify_all();
+    }
+  }
+}  // namespace display_device
@@ -0,0 +1,206 @@
+/**
+ * @file src/common/scheduler_executor.cpp
+ * @brief Definitions for the SchedulerExecutor.
+ */
+// class header include
+#include "display_device/scheduler_executor.h"
+
+// system includes
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+// local includes
+#include "display_device/logging.h"
+#include "display_device/steady_scheduler_clock.h"
+
+namespace display_device {
+  SchedulerExecutor::SchedulerExecutor(const std::size_t worker_count, std::shared_ptr<SchedulerClockInterface> clock):
+      m_worker_count {worker_count},
+      m_clock {clock ? std::move(clock) : std::make_shared<SteadySchedulerClock>()} {
+    m_workers.reserve(m_worker_count);
+    for (std::size_t i {0}; i < m_worker_count; ++i) {
+      m_workers.emplace_back([this]() {
+        runWorkerLoop();
+      });
+    }
+
+    m_timer_thread = std::thread {[this]() {
+      runTimerLoop();
+    }};
+  }
+
+  SchedulerExecutor::~SchedulerExecutor() {
+    {
+      std::lock_guard lock {m_mutex};
+      m_keep_alive = false;
+    }
+    m_timer_cv.notify_all();
+    m_worker_cv.notify_all();
+
+    if (m_timer_thread.joinable()) {
+      m_timer_thread.join();
+    }
+
+    for (auto &worker : m_workers) {
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+  }
+
+  SchedulerExecutor::ClientId SchedulerExecutor::addClient(std::function<void()> callback) {
+    if (!callback) {
+      throw std::invalid_argument {"Empty callback function provided in SchedulerExecutor::addClient!"};
+    }
+
+    std::lock_guard lock {m_mutex};
+    const auto client_id {m_next_client_id++};
+    m_clients.emplace(client_id, Client {.m_callback = std::move(callback)});
+    return client_id;
+  }
+
+  void SchedulerExecutor::removeClient(const ClientId client_id) {
+    std::unique_lock lock {m_mutex};
+    const auto client_it {m_clients.find(client_id)};
+    if (client_it == std::end(m_clients)) {
+      return;
+    }
+
+    auto &client {client_it->second};
+    client.m_removed = true;
+    disarmUnlocked(client, client_id);
+    if (client.m_queued) {
+      std::erase(m_ready, client_id);
+      client.m_queued = false;
+    }
+
+    // The element reference survives a rehash caused by the concurrent addClient, but the iterator does not.
+    m_idle_cv.wait(lock, [&client]() {
+      return !client.m_running;
+    });
+    m_clients.erase(client_id);
+  }
+
+  void SchedulerExecutor::arm(const ClientId client_id, const TimePoint due_time) {
+    std::lock_guard lock {m_mutex};
+    const auto client_it {m_clients.find(client_id)};
+    if (client_it == std::end(m_clients) || client_it->second.m_removed) {
+      return;
+    }
+
+    auto &client {client_it->second};
+    disarmUnlocked(client, client_id);
+
+    // The timer thread only needs to be woken up if its current sleep would overshoot the new deadline.
+    const bool is_earliest {m_timers.empty() || due_time < m_timers.begin()->first};
+    m_timers.emplace(due_time, client_id);
+    client.m_due_time = due_time;
+    if (is_earliest) {
+      m_timer_cv.notify_one();
+    }
+  }
+
+  void SchedulerExecutor::disarm(const ClientId client_id) {
+    std::lock_guard lock {m_mutex};
+    if (const auto client_it {m_clients.find(client_id)}; client_it != std::end(m_clients)) {
+      disarmUnlocked(client_it->second, client_id);
+    }
+  }
+
+  std::size_t SchedulerExecutor::getWorkerCount() const {
+    return m_worker_count;
+  }
+
+  SchedulerClockInterface &SchedulerExecutor::getClock() const {
+    return *m_clock;
+  }
+
+  void SchedulerExecutor::runTimerLoop() {
+    std::unique_lock lock {m_mutex};
+    while (m_keep_alive) {
+      if (m_timers.empty()) {
+        m_timer_cv.wait(lock);
+        continue;
+      }
+
+      const auto [due_time, client_id] {*m_timers.begin()};
+      if (due_time > m_clock->now()) {
+        m_clock->waitUntil(m_timer_cv, lock, due_time);
+        continue;
+      }
+
+      m_timers.erase(m_timers.begin());
+      auto &client {m_clients.at(client_id)};
+      client.m_due_time = std::nullopt;
+
+      if (m_worker_count == 0) {
+        invokeUnlocked(lock, client);
+      } else {
+        dispatchUnlocked(client, client_id);
+      }
+    }
+  }
+
+  void SchedulerExecutor::runWorkerLoop() {
+    std::unique_lock lock {m_mutex};
+    while (m_keep_alive) {
+      if (m_ready.empty()) {
+        m_worker_cv.wait(lock);
+        continue;
+      }
+
+      const auto client_id {m_ready.front()};
+      m_ready.pop_front();
+
+      auto &client {m_clients.at(client_id)};
+      client.m_queued = false;
+      invokeUnlocked(lock, client);
+
+      if (client.m_rerun && !client.m_removed) {
+        client.m_rerun = false;
+        dispatchUnlocked(client, client_id);
+      }
+    }
+  }
+
+  void SchedulerExecutor::disarmUnlocked(Client &client, const ClientId client_id) {
+    if (client.m_due_time) {
+      m_timers.erase({*client.m_due_time, client_id});
+      client.m_due_time = std::nullopt;
+    }
+    client.m_rerun = false;
+  }
+
+  void SchedulerExecutor::dispatchUnlocked(Client &client, const ClientId client_id) {
+    if (client.m_queued) {
+      return;
+    }
+
+    if (client.m_running) {
+      client.m_rerun = true;
+      return;
+    }
+
+    client.m_queued = true;
+    m_ready.push_back(client_id);
+    m_worker_cv.notify_one();
+  }
+
+  void SchedulerExecutor::invokeUnlocked(std::unique_lock<std::mutex> &lock, Client &client) {
+    client.m_running = true;
+    lock.unlock();
+
+    try {
+      // The callback is never modified once the client is added and the client cannot be removed while running.
+      client.m_callback();
+    } catch (const std::exception &error) {  // NOSONAR(cpp:S1181): Executor callback boundary must catch standard callback failures.
+      DD_LOG_CAT(scheduler, error) << "Exception thrown in the SchedulerExecutor callback. Ignoring. Error:\n"
+                                   << error.what();
+    }
+
+    lock.lock();
+    client.m_running = false;
+    m_idle_cv.notify_all();
+  }
+}  // namespace display_device
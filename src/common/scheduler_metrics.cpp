@@ -0,0 +1,110 @@
+/**
+ * @file src/common/scheduler_metrics.cpp
+ * @brief Definitions for the SchedulerMetrics.
+ */
+// class header include
+#include "display_device/scheduler_metrics.h"
+
+// system includes
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace display_device {
+  std::uint64_t MetricsHistogramSnapshot::getBucketUpperBound(const std::size_t index) {
+    if (index + 1 >= m_bucket_count) {
+      return std::numeric_limits<std::uint64_t>::max();
+    }
+
+    return (std::uint64_t {1} << index) - 1;
+  }
+
+  std::uint64_t MetricsHistogramSnapshot::getPercentile(const double percentile) const {
+    if (m_count == 0) {
+      return 0;
+    }
+
+    const auto rank {static_cast<std::uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(m_count)))};
+    std::uint64_t seen {0};
+    for (std::size_t i {0}; i < m_bucket_count; ++i) {
+      seen += m_buckets[i];
+      if (seen >= std::max<std::uint64_t>(rank, 1)) {
+        return std::min(getBucketUpperBound(i), m_max);
+      }
+    }
+
+    return m_max;
+  }
+
+  void MetricsHistogram::record(const std::uint64_t value) {
+    const auto index {std::min<std::size_t>(std::bit_width(value), MetricsHistogramSnapshot::m_bucket_count - 1)};
+    m_buckets[index].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+
+    auto current_max {m_max.load(std::memory_order_relaxed)};
+    while (value > current_max && !m_max.compare_exchange_weak(current_max, value, std::memory_order_relaxed)) {
+      // current_max is updated by compare_exchange_weak
+    }
+  }
+
+  void MetricsHistogram::recordDuration(const std::chrono::nanoseconds duration) {
+    const auto duration_us {std::chrono::duration_cast<std::chrono::microseconds>(duration).count()};
+    record(duration_us > 0 ? static_cast<std::uint64_t>(duration_us) : 0);
+  }
+
+  MetricsHistogramSnapshot MetricsHistogram::snapshot() const {
+    MetricsHistogramSnapshot result;
+    for (std::size_t i {0}; i < m_buckets.size(); ++i) {
+      result.m_buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+    }
+    result.m_count = m_count.load(std::memory_order_relaxed);
+    result.m_sum = m_sum.load(std::memory_order_relaxed);
+    result.m_max = m_max.load(std::memory_order_relaxed);
+    return result;
+  }
+
+  void SchedulerMetrics::recordSchedule() {
+    m_schedules.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void SchedulerMetrics::recordAttempt(const std::chrono::nanoseconds duration) {
+    m_attempts.fetch_add(1, std::memory_order_relaxed);
+    m_callback_duration_us.recordDuration(duration);
+  }
+
+  void SchedulerMetrics::recordSuccess(const std::uint64_t attempts, const std::chrono::nanoseconds time_to_success) {
+    m_successes.fetch_add(1, std::memory_order_relaxed);
+    m_attempts_per_schedule.record(attempts);
+    m_time_to_success_us.recordDuration(time_to_success);
+  }
+
+  void SchedulerMetrics::recordException(const std::uint64_t attempts) {
+    m_exceptions.fetch_add(1, std::memory_order_relaxed);
+    m_attempts_per_schedule.record(attempts);
+  }
+
+  void SchedulerMetrics::recordGiveUp(const std::uint64_t attempts) {
+    m_give_ups.fetch_add(1, std::memory_order_relaxed);
+    m_attempts_per_schedule.record(attempts);
+  }
+
+  void SchedulerMetrics::recordMutexWait(const std::chrono::nanoseconds duration) {
+    m_mutex_wait_us.recordDuration(duration);
+  }
+
+  SchedulerMetricsSnapshot SchedulerMetrics::snapshot() const {
+    return {
+      .m_schedules = m_schedules.load(std::memory_order_relaxed),
+      .m_attempts = m_attempts.load(std::memory_order_relaxed),
+      .m_successes = m_successes.load(std::memory_order_relaxed),
+      .m_exceptions = m_exceptions.load(std::memory_order_relaxed),
+      .m_give_ups = m_give_ups.load(std::memory_order_relaxed),
+      .m_attempts_per_schedule = m_attempts_per_schedule.snapshot(),
+      .m_time_to_success_us = m_time_to_success_us.snapshot(),
+      .m_callback_duration_us = m_callback_duration_us.snapshot(),
+      .m_mutex_wait_us = m_mutex_wait_us.snapshot()
+    };
+  }
+}  // namespace display_device
@@ -0,0 +1,23 @@
+/**
+ * @file src/common/steady_scheduler_clock.cpp
+ * @brief Definitions for the SteadySchedulerClock.
+ */
+// class header include
+#include "display_device/steady_scheduler_clock.h"
+
+// system includes
+#include <thread>
+
+namespace display_device {
+  SchedulerClockInterface::TimePoint SteadySchedulerClock::now() const {
+    return std::chrono::steady_clock::now();
+  }
+
+  void SteadySchedulerClock::sleepUntil(const TimePoint time_point) {
+    std::this_thread::sleep_until(time_point);
+  }
+
+  void SteadySchedulerClock::waitUntil(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, const TimePoint time_point) {
+    cv.wait_until(lock, time_point);
+  }
+}  // namespace display_device
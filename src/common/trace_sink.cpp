@@ -0,0 +1,589 @@
+/**
+ * @file src/common/trace_sink.cpp
+ * @brief Definitions for the binary trace sink.
+ */
+// class header include
+#include "display_device/trace_sink.h"
+
+// system includes
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+#include <variant>
+
+#ifdef _WIN32
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <cerrno>
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <system_error>
+  #include <unistd.h>
+#endif
+
+namespace display_device {
+  namespace {
+    constexpr std::array<char, 8> FILE_MAGIC {'D', 'D', 'T', 'R', 'A', 'C', 'E', '\0'};
+    constexpr std::uint32_t FILE_VERSION {1};
+    constexpr std::uint32_t BYTE_ORDER_MARK {0x01020304};
+    constexpr std::uint8_t TRUNCATED_FLAG {0x01};
+    constexpr std::uint64_t WRITING_FLAG {std::uint64_t {1} << 63};  ///< Set in the record sequence while the slot is being written.
+
+    /**
+     * @brief Header at the beginning of the trace file.
+     */
+    struct FileHeader {
+      std::array<char, 8> m_magic;  ///< Identifies the trace file.
+      std::uint32_t m_version;  ///< Version of the layout.
+      std::uint32_t m_byte_order;  ///< Detects the byte order mismatch.
+      std::uint64_t m_record_capacity;  ///< Number of the record slots.
+      std::uint32_t m_record_size;  ///< Size of a single record slot.
+      std::uint32_t m_format_capacity;  ///< Number of the dictionary entries.
+      std::uint64_t m_next_sequence;  ///< Number of the records claimed so far (accessed atomically).
+      std::uint64_t m_format_count;  ///< Number of the used dictionary entries (accessed atomically).
+      std::array<std::byte, 16> m_reserved;  ///< Reserved for the future use.
+    };
+
+    /**
+     * @brief Dictionary entry mapping the format identifier to the format string.
+     */
+    struct FormatEntry {
+      std::uint64_t m_id;  ///< Format identifier.
+      std::uint32_t m_length;  ///< Length of the stored format string.
+      std::array<char, 244> m_text;  ///< Format string, cut off if it is longer.
+    };
+
+    /**
+     * @brief Header of the record slot, followed by the encoded arguments.
+     */
+    struct RecordHeader {
+      std::uint64_t m_sequence;  ///< Number of the record starting from 1, 0 if the slot is unused. Has the `WRITING_FLAG` while being written (accessed atomically).
+      std::int64_t m_timestamp;  ///< Nanoseconds since the Unix epoch.
+      std::uint64_t m_format_id;  ///< Format identifier.
+      std::uint16_t m_size;  ///< Number of the encoded argument bytes.
+      std::uint8_t m_flags;  ///< Record flags.
+      std::array<std::byte, 5> m_reserved;  ///< Reserved for the future use.
+    };
+
+    static_assert(sizeof(FileHeader) == 64 && sizeof(FormatEntry) == 256 && sizeof(RecordHeader) == 32, "Unexpected trace file layout!");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free && sizeof(std::atomic<std::uint64_t>) == sizeof(std::uint64_t), "Trace file fields cannot be accessed atomically!");
+
+    /**
+     * @brief Access the mapped value atomically.
+     */
+    std::atomic<std::uint64_t> &asAtomic(std::uint64_t &value) {
+      return *reinterpret_cast<std::atomic<std::uint64_t> *>(&value);  // NOSONAR(cpp:S3630): Lock-free atomic has the same representation as the mapped value.
+    }
+
+    std::size_t getFileSize(const TraceSink::Options &options) {
+      return sizeof(FileHeader) + options.m_format_capacity * sizeof(FormatEntry) + options.m_record_capacity * options.m_record_size;
+    }
+
+    bool isHeaderValid(const FileHeader &header) {
+      return header.m_magic == FILE_MAGIC && header.m_version == FILE_VERSION && header.m_byte_order == BYTE_ORDER_MARK;
+    }
+
+    bool isLayoutSame(const FileHeader &header, const TraceSink::Options &options) {
+      return header.m_record_capacity == options.m_record_capacity &&
+             header.m_record_size == options.m_record_size &&
+             header.m_format_capacity == options.m_format_capacity &&
+             header.m_format_count <= options.m_format_capacity;
+    }
+
+    /**
+     * @brief Decode the arguments until the bytes run out.
+     * @returns False if the last argument was cut off.
+     */
+    bool decodeArguments(std::span<const std::byte> bytes, std::vector<Logger::FieldValue> &arguments) {
+      using enum TraceArguments::Type;
+
+      const auto read {[&bytes]<class T>(T &value) {
+        if (bytes.size() < sizeof(T)) {
+          return false;
+        }
+        std::memcpy(&value, bytes.data(), sizeof(T));
+        bytes = bytes.subspan(sizeof(T));
+        return true;
+      }};
+
+      while (!bytes.empty()) {
+        const auto type {static_cast<TraceArguments::Type>(bytes.front())};
+        bytes = bytes.subspan(1);
+
+        switch (type) {
+          case Bool:
+            {
+              bool value {};
+              if (!read(value)) {
+                return false;
+              }
+              arguments.emplace_back(value);
+              break;
+            }
+          case Int:
+            {
+              std::int64_t value {};
+              if (!read(value)) {
+                return false;
+              }
+              arguments.emplace_back(value);
+              break;
+            }
+          case UInt:
+            {
+              std::uint64_t value {};
+              if (!read(value)) {
+                return false;
+              }
+              arguments.emplace_back(value);
+              break;
+            }
+          case Double:
+            {
+              double value {};
+              if (!read(value)) {
+                return false;
+              }
+              arguments.emplace_back(value);
+              break;
+            }
+          case String:
+            {
+              std::uint16_t length {};
+              if (!read(length)) {
+                return false;
+              }
+              const auto available {std::min<std::size_t>(length, bytes.size())};
+              arguments.emplace_back(std::string {reinterpret_cast<const char *>(bytes.data()), available});
+              bytes = bytes.subspan(available);
+              if (available < length) {
+                return false;
+              }
+              break;
+            }
+          default:
+            // Unknown tag, the rest cannot be interpreted
+            return false;
+        }
+      }
+      return true;
+    }
+
+#ifdef _WIN32
+    bool setFileSize(const HANDLE file, const LONGLONG size) {
+      LARGE_INTEGER position {};
+      position.QuadPart = size;
+      return SetFilePointerEx(file, position, nullptr, FILE_BEGIN) && SetEndOfFile(file);
+    }
+#endif
+
+    void appendArgument(std::string &output, const Logger::FieldValue &argument) {
+      std::visit([&output](const auto &value) {
+        std::format_to(std::back_inserter(output), "{}", value);
+      },
+                 argument);
+    }
+  }  // namespace
+
+  /**
+   * @brief Platform specific read-write mapping of the whole file.
+   */
+  class TraceSink::MappedFile final {
+  public:
+    /**
+     * @brief Default constructor.
+     * @param filepath Path to the file to be opened or created.
+     * @param size Size of the file. If the file has a different size, it is zero-filled.
+     */
+    MappedFile(const std::filesystem::path &filepath, const std::size_t size):
+        m_size {size} {
+#ifdef _WIN32
+      m_file = CreateFileW(filepath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (m_file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error {"Failed to open " + filepath.string() + " in TraceSink! Error: " + std::to_string(GetLastError())};
+      }
+
+      LARGE_INTEGER current_size {};
+      if (!GetFileSizeEx(m_file, &current_size) || static_cast<std::size_t>(current_size.QuadPart) != size) {
+        if (!setFileSize(m_file, 0) || !setFileSize(m_file, static_cast<LONGLONG>(size))) {
+          const auto error {GetLastError()};
+          close();
+          throw std::runtime_error {"Failed to resize " + filepath.string() + " in TraceSink! Error: " + std::to_string(error)};
+        }
+      }
+
+      m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+      m_data = m_mapping ? MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size) : nullptr;
+      if (!m_data) {
+        const auto error {GetLastError()};
+        close();
+        throw std::runtime_error {"Failed to map " + filepath.string() + " in TraceSink! Error: " + std::to_string(error)};
+      }
+#else
+      m_file = ::open(filepath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+      if (m_file < 0) {
+        throw std::runtime_error {"Failed to open " + filepath.string() + " in TraceSink! Error: " + std::generic_category().message(errno)};
+      }
+
+      struct stat file_stat {};
+      if (::fstat(m_file, &file_stat) != 0 || static_cast<std::size_t>(file_stat.st_size) != size) {
+        if (::ftruncate(m_file, 0) != 0 || ::ftruncate(m_file, static_cast<off_t>(size)) != 0) {
+          const auto error {errno};
+          close();
+          throw std::runtime_error {"Failed to resize " + filepath.string() + " in TraceSink! Error: " + std::generic_category().message(error)};
+        }
+      }
+
+      m_data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+      if (m_data == MAP_FAILED) {
+        const auto error {errno};
+        m_data = nullptr;
+        close();
+        throw std::runtime_error {"Failed to map " + filepath.string() + " in TraceSink! Error: " + std::generic_category().message(error)};
+      }
+#endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile() {
+      close();
+    }
+
+    /**
+     * @brief Get the mapped bytes.
+     */
+    [[nodiscard]] std::byte *getData() const {
+      return static_cast<std::byte *>(m_data);
+    }
+
+    /**
+     * @brief Write the mapped bytes out to the disk.
+     */
+    void flush() const {
+#ifdef _WIN32
+      FlushViewOfFile(m_data, 0);
+      FlushFileBuffers(m_file);
+#else
+      ::msync(m_data, m_size, MS_SYNC);
+#endif
+    }
+
+  private:
+    void close() {
+#ifdef _WIN32
+      if (m_data) {
+        UnmapViewOfFile(m_data);
+      }
+      if (m_mapping) {
+        CloseHandle(m_mapping);
+      }
+      if (m_file != INVALID_HANDLE_VALUE) {
+        CloseHandle(m_file);
+      }
+#else
+      if (m_data) {
+        ::munmap(m_data, m_size);
+      }
+      if (m_file >= 0) {
+        ::close(m_file);
+      }
+#endif
+    }
+
+    std::size_t m_size;  ///< Size of the mapping.
+    void *m_data {nullptr};  ///< Mapped bytes.
+#ifdef _WIN32
+    HANDLE m_file {INVALID_HANDLE_VALUE};  ///< File handle.
+    HANDLE m_mapping {nullptr};  ///< File mapping handle.
+#else
+    int m_file {-1};  ///< File descriptor.
+#endif
+  };
+
+  TraceSink::TraceSink(std::filesystem::path filepath, const Options &options):
+      m_filepath {std::move(filepath)},
+      m_options {options} {
+    if (m_filepath.empty()) {
+      throw std::invalid_argument {"Empty filename provided for TraceSink!"};
+    }
+    if (m_options.m_record_capacity == 0 || m_options.m_format_capacity == 0) {
+      throw std::invalid_argument {"Record and format capacities specified in TraceSink must be larger than a 0!"};
+    }
+    if (m_options.m_record_size % 8 != 0 || m_options.m_record_size < 64 || m_options.m_record_size > 4096) {
+      throw std::invalid_argument {"Record size specified in TraceSink must be a multiple of 8 in the [64, 4096] range!"};
+    }
+
+    m_file = std::make_unique<MappedFile>(m_filepath, getFileSize(m_options));
+    m_known_formats_mask = std::bit_ceil(m_options.m_format_capacity * 2) - 1;
+    m_known_formats = std::make_unique<std::atomic<std::uint64_t>[]>(m_known_formats_mask + 1);  // NOSONAR(cpp:S5945): Atomics are not movable, so a vector cannot be used.
+
+    auto &header {*reinterpret_cast<FileHeader *>(m_file->getData())};  // NOSONAR(cpp:S3630): The mapped bytes are the file layout.
+    if (isHeaderValid(header) && isLayoutSame(header, m_options)) {
+      DD_LOG(info) << "Continuing the trace file " << m_filepath << " after " << header.m_next_sequence << " record(s).";
+
+      const auto *entries {reinterpret_cast<const FormatEntry *>(m_file->getData() + sizeof(FileHeader))};  // NOSONAR(cpp:S3630): The mapped bytes are the file layout.
+      for (std::size_t i {0}; i < header.m_format_count; ++i) {
+        insertKnownFormat(entries[i].m_id);
+      }
+      m_dictionary_full = header.m_format_count == m_options.m_format_capacity;
+
+      // Slots left half-written by a crash would otherwise never be claimed again.
+      for (std::size_t i {0}; i < m_options.m_record_capacity; ++i) {
+        auto &record {*reinterpret_cast<RecordHeader *>(getSlot(i))};  // NOSONAR(cpp:S3630): The mapped bytes are the file layout.
+        if ((record.m_sequence & WRITING_FLAG) != 0) {
+          record.m_sequence = 0;
+        }
+      }
+      return;
+    }
+
+    std::memset(m_file->getData(), 0, getFileSize(m_options));
+    header.m_magic = FILE_MAGIC;
+    header.m_version = FILE_VERSION;
+    header.m_byte_order = BYTE_ORDER_MARK;
+    header.m_record_capacity = m_options.m_record_capacity;
+    header.m_record_size = static_cast<std::uint32_t>(m_options.m_record_size);
+    header.m_format_capacity = static_cast<std::uint32_t>(m_options.m_format_capacity);
+  }
+
+  TraceSink::~TraceSink() = default;
+
+  void TraceSink::write(const TraceFormat &format, const TraceArguments &arguments) {
+    if (!isKnownFormat(format.m_id)) {
+      registerFormat(format);
+    }
+
+    auto *data {m_file->getData()};
+    auto &header {*reinterpret_cast<FileHeader *>(data)};  // NOSONAR(cpp:S3630): The mapped bytes are the file layout.
+    const auto sequence {asAtomic(header.m_next_sequence).fetch_add(1, std::memory_order_relaxed) + 1};
+
+    auto *slot {getSlot((sequence - 1) % m_options.m_record_capacity)};
+    auto &record {*reinterpret_cast<RecordHeader *>(slot)};  // NOSONAR(cpp:S3630): The mapped bytes are the file layout.
+
+    // The slot is claimed before being overwritten, so that neither a concurrent writer of the same slot
+    // (one lap ahead or behind) nor a crash can leave a mixed up record behind. The writer that
+    // cannot claim the slot drops its record.
+    auto previous_sequence {asAtomic(record.m_sequence).load(std::memory_order_relaxed)};
+    do {
+      if ((previous_sequence & WRITING_FLAG) != 0 || previous_sequence >= sequence) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+    } while (!asAtomic(record.m_sequence).compare_exchange_weak(previous_sequence, sequence | WRITING_FLAG, std::memory_order_relaxed));
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const auto bytes {arguments.getBytes()};
+    const auto size {std::min(bytes.size(), m_options.m_record_size - sizeof(RecordHeader))};
+    record.m_timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    record.m_format_id = format.m_id;
+    record.m_size = static_cast<std::uint16_t>(size);
+    record.m_flags = arguments.isTruncated() || size < bytes.size() ? TRUNCATED_FLAG : 0;
+    std::memcpy(slot + sizeof(RecordHeader), bytes.data(), size);
+
+    asAtomic(record.m_sequence).store(sequence, std::memory_order_release);
+  }
+
+  void TraceSink::flush() {
+    m_file->flush();
+  }
+
+  const std::filesystem::path &TraceSink::getFilepath() const {
+    return m_filepath;
+  }
+
+  std::uint64_t TraceSink::getDroppedCount() const {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+  std::byte *TraceSink::getSlot(const std::size_t index) const {
+    return m_file->getData() + sizeof(FileHeader) + m_options.m_format_capacity * sizeof(FormatEntry) + index * m_options.m_record_size;
+  }
+
+  bool TraceSink::isKnownFormat(const std::uint64_t format_id) const {
+    // The set is at least twice as large as the dictionary, so there is always an unused entry to stop at.
+    for (auto index {format_id & m_known_formats_mask};; index = (index + 1) & m_known_formats_mask) {
+      const auto known_id {m_known_formats[index].load(std::memory_order_acquire)};
+      if (known_id == format_id) {
+        return true;
+      }
+      if (known_id == 0) {
+        return false;
+      }
+    }
+  }
+
+  void TraceSink::registerFormat(const TraceFormat &format) {
+    if (m_dictionary_full.load(std::memory_order_relaxed)) {
+      return;
+    }
+
+    std::lock_guard lock {m_dictionary_mutex};
+    if (isKnownFormat(format.m_id)) {
+      return;
+    }
+
+    auto &header {*reinterpret_cast<FileHeader *>(m_file->getData())};  // NOSONAR(cpp:S3630): The mapped bytes are the file layout.
+    const auto format_count {header.m_format_count};
+    if (format_count >= m_options.m_format_capacity) {
+      DD_LOG(warning) << "Trace format dictionary of " << m_filepath << " is full, the records with new formats will not be decodable!";
+      m_dictionary_full = true;
+      return;
+    }
+
+    auto &entry {*reinterpret_cast<FormatEntry *>(m_file->getData() + sizeof(FileHeader) + format_count * sizeof(FormatEntry))};  // NOSONAR(cpp:S3630): The mapped bytes are the file layout.
+    entry.m_id = format.m_id;
+    entry.m_length = static_cast<std::uint32_t>(std::min(format.m_text.size(), entry.m_text.size()));
+    std::memcpy(entry.m_text.data(), format.m_text.data(), entry.m_length);
+    asAtomic(header.m_format_count).store(format_count + 1, std::memory_order_release);
+
+    insertKnownFormat(format.m_id);
+  }
+
+  void TraceSink::insertKnownFormat(const std::uint64_t format_id) {
+    for (auto index {format_id & m_known_formats_mask};; index = (index + 1) & m_known_formats_mask) {
+      auto &known_id {m_known_formats[index]};
+      if (const auto value {known_id.load(std::memory_order_relaxed)}; value == 0 || value == format_id) {
+        known_id.store(format_id, std::memory_order_release);
+        return;
+      }
+    }
+  }
+
+  std::optional<std::vector<TraceRecord>> readTraceFile(const std::filesystem::path &filepath) {
+    std::vector<std::byte> data;
+    try {
+      std::ifstream stream {filepath, std::ios::binary};
+      if (!stream) {
+        DD_LOG(error) << "Failed to open " << filepath << " for reading!";
+        return std::nullopt;
+      }
+
+      std::vector<char> contents {std::istreambuf_iterator<char> {stream}, std::istreambuf_iterator<char> {}};
+      data.resize(contents.size());
+      std::memcpy(data.data(), contents.data(), contents.size());
+    } catch (const std::ios_base::failure &error) {
+      DD_LOG(error) << "Failed to read " << filepath << "! Error:\n"
+                    << error.what();
+      return std::nullopt;
+    }
+
+    FileHeader header {};
+    if (data.size() < sizeof(header)) {
+      DD_LOG(error) << "File " << filepath << " is not a trace file!";
+      return std::nullopt;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (!isHeaderValid(header)) {
+      DD_LOG(error) << "File " << filepath << " is not a trace file or was written by an incompatible version!";
+      return std::nullopt;
+    }
+
+    const TraceSink::Options options {.m_record_capacity = header.m_record_capacity, .m_record_size = header.m_record_size, .m_format_capacity = header.m_format_capacity};
+    if (!isLayoutSame(header, options) || options.m_record_size < sizeof(RecordHeader) || data.size() != getFileSize(options)) {
+      DD_LOG(error) << "Trace file " << filepath << " is corrupted!";
+      return std::nullopt;
+    }
+
+    std::unordered_map<std::uint64_t, std::string> formats;
+    for (std::size_t i {0}; i < header.m_format_count; ++i) {
+      FormatEntry entry {};
+      std::memcpy(&entry, data.data() + sizeof(FileHeader) + i * sizeof(FormatEntry), sizeof(entry));
+      formats[entry.m_id] = std::string {entry.m_text.data(), std::min<std::size_t>(entry.m_length, entry.m_text.size())};
+    }
+
+    std::vector<TraceRecord> records;
+    const auto *slots {data.data() + sizeof(FileHeader) + options.m_format_capacity * sizeof(FormatEntry)};
+    for (std::size_t i {0}; i < options.m_record_capacity; ++i) {
+      const auto *slot {slots + i * options.m_record_size};
+      RecordHeader record_header {};
+      std::memcpy(&record_header, slot, sizeof(record_header));
+      if (record_header.m_sequence == 0 || (record_header.m_sequence & WRITING_FLAG) != 0) {
+        continue;
+      }
+
+      TraceRecord record {
+        .m_sequence = record_header.m_sequence,
+        .m_timestamp = std::chrono::system_clock::time_point {std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds {record_header.m_timestamp})},
+        .m_truncated = (record_header.m_flags & TRUNCATED_FLAG) != 0
+      };
+      if (const auto format_it {formats.find(record_header.m_format_id)}; format_it != std::end(formats)) {
+        record.m_format = format_it->second;
+      }
+
+      const std::span<const std::byte> bytes {slot + sizeof(RecordHeader), std::min<std::size_t>(record_header.m_size, options.m_record_size - sizeof(RecordHeader))};
+      if (!decodeArguments(bytes, record.m_arguments)) {
+        record.m_truncated = true;
+      }
+      records.push_back(std::move(record));
+    }
+
+    std::ranges::sort(records, {}, &TraceRecord::m_sequence);
+    return records;
+  }
+
+  std::string formatTraceRecord(const TraceRecord &record) {
+    const auto since_epoch {std::chrono::duration_cast<std::chrono::microseconds>(record.m_timestamp.time_since_epoch())};
+    const std::chrono::sys_days day {std::chrono::floor<std::chrono::days>(since_epoch)};
+    const std::chrono::year_month_day date {day};
+    const std::chrono::hh_mm_ss time_of_day {since_epoch - day.time_since_epoch()};
+
+    std::string output;
+    std::format_to(
+      std::back_inserter(output),
+      "[{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.{:06}Z] ",
+      static_cast<int>(date.year()),
+      static_cast<unsigned>(date.month()),
+      static_cast<unsigned>(date.day()),
+      time_of_day.hours().count(),
+      time_of_day.minutes().count(),
+      time_of_day.seconds().count(),
+      time_of_day.subseconds().count()
+    );
+
+    if (!record.m_format) {
+      output += "<unknown format>";
+      for (const auto &argument : record.m_arguments) {
+        output += ' ';
+        appendArgument(output, argument);
+      }
+    } else {
+      const std::string_view text {*record.m_format};
+      auto argument_it {std::begin(record.m_arguments)};
+      for (std::size_t i {0}; i < text.size(); ++i) {
+        const char character {text[i]};
+        const bool escaped {(character == '{' || character == '}') && i + 1 < text.size() && text[i + 1] == character};
+        if (escaped) {
+          output += character;
+          ++i;
+          continue;
+        }
+
+        const auto close_pos {character == '{' ? text.find('}', i) : std::string_view::npos};
+        if (close_pos == std::string_view::npos || argument_it == std::end(record.m_arguments)) {
+          output += character;
+          continue;
+        }
+
+        // The format specification (if any) is ignored
+        appendArgument(output, *argument_it++);
+        i = close_pos;
+      }
+    }
+
+    if (record.m_truncated) {
+      output += " [truncated]";
+    }
+    return output;
+  }
+}  // namespace display_device
@@ -0,0 +1,155 @@
+/**
+ * @file src/common/write_behind_settings_persistence.cpp
+ * @brief Definitions for the WriteBehindSettingsPersistence.
+ */
+// class header include
+#include "display_device/write_behind_settings_persistence.h"
+
+// system includes
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+// local includes
+#include "display_device/logging.h"
+
+namespace display_device {
+  WriteBehindSettingsPersistence::WriteBehindSettingsPersistence(std::shared_ptr<SettingsPersistenceInterface> persistence_api, const Policy policy):
+      m_persistence_api {persistence_api ? std::move(persistence_api) : throw std::invalid_argument {"Nullptr interface provided in WriteBehindSettingsPersistence!"}},
+      m_policy {policy} {
+    m_thread = std::thread {[this]() {
+      runWorkerLoop();
+    }};
+  }
+
+  WriteBehindSettingsPersistence::~WriteBehindSettingsPersistence() {
+    {
+      std::lock_guard lock {m_mutex};
+      m_keep_alive = false;
+    }
+    m_pending_cv.notify_all();
+
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+  }
+
+  bool WriteBehindSettingsPersistence::store(const std::vector<std::uint8_t> &data) {
+    return enqueue(data);
+  }
+
+  std::optional<std::vector<std::uint8_t>> WriteBehindSettingsPersistence::load() const {
+    {
+      std::lock_guard lock {m_mutex};
+      if (m_latest) {
+        return m_latest->m_data.value_or(std::vector<std::uint8_t> {});
+      }
+    }
+
+    return m_persistence_api->load();
+  }
+
+  std::optional<SettingsDataView> WriteBehindSettingsPersistence::loadView() const {
+    {
+      std::lock_guard lock {m_mutex};
+      if (m_latest) {
+        if (!m_latest->m_data) {
+          return SettingsDataView {};
+        }
+
+        // The operation is immutable, so the view can share it instead of copying the data.
+        return SettingsDataView {*m_latest->m_data, m_latest};
+      }
+    }
+
+    return m_persistence_api->loadView();
+  }
+
+  bool WriteBehindSettingsPersistence::clear() {
+    return enqueue(std::nullopt);
+  }
+
+  bool WriteBehindSettingsPersistence::flush() {
+    std::unique_lock lock {m_mutex};
+    const auto sequence {m_next_sequence - 1};
+    m_written_cv.wait(lock, [this, sequence]() {
+      return m_written_sequence >= sequence;
+    });
+
+    return !std::exchange(m_failed, false);
+  }
+
+  const std::shared_ptr<SettingsPersistenceInterface> &WriteBehindSettingsPersistence::getPersistenceApi() const {
+    return m_persistence_api;
+  }
+
+  bool WriteBehindSettingsPersistence::enqueue(std::optional<std::vector<std::uint8_t>> data) {
+    std::unique_lock lock {m_mutex};
+    std::shared_ptr<WriteResult> result;
+    if (m_policy == Policy::Durability) {
+      // The superseded operation is never written, so its callers are answered by the write of this one.
+      result = m_pending ? m_pending->m_result : std::make_shared<WriteResult>();
+    }
+
+    m_latest = std::make_shared<const Operation>(Operation {.m_sequence = m_next_sequence++, .m_data = std::move(data), .m_result = result});
+    m_pending = m_latest;
+    m_pending_cv.notify_one();
+
+    if (!result) {
+      return true;
+    }
+
+    // The result is tracked per write, so that a newer write finishing in the meantime does not change it.
+    m_written_cv.wait(lock, [&result]() {
+      return result->m_success.has_value();
+    });
+    return *result->m_success;
+  }
+
+  bool WriteBehindSettingsPersistence::write(const Operation &operation) const {
+    try {
+      return operation.m_data ? m_persistence_api->store(*operation.m_data) : m_persistence_api->clear();
+    } catch (const std::exception &error) {
+      DD_LOG_CAT(persistence, error) << "Exception thrown while writing persistent settings! Error:\n"
+                                     << error.what();
+    } catch (...) {  // NOSONAR(cpp:S2738): The thread must survive any exception.
+      DD_LOG_CAT(persistence, error) << "Unknown exception thrown while writing persistent settings!";
+    }
+    return false;
+  }
+
+  void WriteBehindSettingsPersistence::runWorkerLoop() {
+    std::unique_lock lock {m_mutex};
+    while (true) {
+      m_pending_cv.wait(lock, [this]() {
+        return m_pending || !m_keep_alive;
+      });
+      if (!m_pending) {
+        break;
+      }
+
+      const auto operation {std::exchange(m_pending, nullptr)};
+      lock.unlock();
+      const bool result {write(*operation)};
+      if (!result) {
+        DD_LOG_CAT(persistence, error) << "Failed to write persistent settings in the background!";
+      }
+      lock.lock();
+
+      // Newer operations have to stay cached until they are written too. In the durability mode,
+      // the failed operation was never acknowledged, so the reads fall through to the wrapped interface.
+      if (m_latest == operation && (result || m_policy == Policy::Durability)) {
+        m_latest = nullptr;
+      }
+      if (!result) {
+        m_failed = true;
+      }
+
+      m_written_sequence = operation->m_sequence;
+      if (operation->m_result) {
+        operation->m_result->m_success = result;
+      }
+      m_written_cv.notify_all();
+    }
+  }
+}  // namespace display_device
@@ -17,7 +17,7 @@ namespace display_device {
     return std::make_unique<MacSettingsManager>(
       std::make_shared<MacDisplayDevice>(api_layer),
       config.m_audio_context_api,
-      std::make_unique<MacPersistentState>(config.m_settings_persistence_api, config.m_throw_on_persistence_load_error),
+      std::make_unique<MacPersistentState>(config.m_settings_persistence_api, config.m_throw_on_persistence_load_error, config.m_persistence_encoding, config.m_persistence_load_mode),
       MacWorkarounds {}
     );
   }
@@ -13,4 +13,5 @@ namespace display_device {
   DD_JSON_DECLARE_CONVERTER(MacDeviceDisplayModeMap)
   DD_JSON_DECLARE_CONVERTER(MacHdrStateMap)
   DD_JSON_DECLARE_CONVERTER(MacSingleDisplayConfigState)
+  DD_JSON_DECLARE_CBOR_CONVERTER(MacSingleDisplayConfigState)
 }  // namespace display_device
@@ -9,6 +9,7 @@
 
 // local includes
 #include "display_device/audio_context_interface.h"
+#include "display_device/logging.h"
 #include "display_device/settings_manager_interface.h"
 #include "mac_display_device_interface.h"
 #include "persistent_state.h"
@@ -74,5 +75,6 @@ namespace display_device {
     std::shared_ptr<AudioContextInterface> m_audio_context_api;
     std::unique_ptr<MacPersistentState> m_persistence_state;
     [[no_unique_address]] MacWorkarounds m_workarounds;
+    LogRepeatLimiter m_revert_log_limiter;
   };
 }  // namespace display_device
@@ -17,4 +17,5 @@ namespace display_device {
   DD_JSON_DEFINE_CONVERTER(MacDeviceDisplayModeMap)
   DD_JSON_DEFINE_CONVERTER(MacHdrStateMap)
   DD_JSON_DEFINE_CONVERTER(MacSingleDisplayConfigState)
+  DD_JSON_DEFINE_CBOR_CONVERTER(MacSingleDisplayConfigState)
 }  // namespace display_device
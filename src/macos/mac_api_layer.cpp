@@ -535,14 +535,14 @@ namespace display_device {
   std::optional<MacPowerAssertionId> MacApiLayer::declareUserActivity(const std::string &reason) {
     const auto assertion_reason {toCfString(reason.empty() ? "libdisplaydevice display detection" : reason)};
     if (!assertion_reason) {
-      DD_LOG(error) << "Failed to create macOS display wake assertion reason.";
+      DD_LOG_CAT(power, error) << "Failed to create macOS display wake assertion reason.";
       return std::nullopt;
     }
 
     IOPMAssertionID assertion_id {};
     const auto result {IOPMAssertionDeclareUserActivity(assertion_reason.get(), kIOPMUserActiveRemote, &assertion_id)};
     if (result != kIOReturnSuccess) {
-      DD_LOG(error) << "Failed to declare macOS user activity for display wake: " << result;
+      DD_LOG_CAT(power, error) << "Failed to declare macOS user activity for display wake: " << result;
       return std::nullopt;
     }
 
@@ -552,14 +552,14 @@ namespace display_device {
   std::optional<MacPowerAssertionId> MacApiLayer::createDisplaySleepAssertion(const std::string &reason) {
     const auto assertion_reason {toCfString(reason.empty() ? "libdisplaydevice display capture" : reason)};
     if (!assertion_reason) {
-      DD_LOG(error) << "Failed to create macOS display sleep assertion reason.";
+      DD_LOG_CAT(power, error) << "Failed to create macOS display sleep assertion reason.";
       return std::nullopt;
     }
 
     IOPMAssertionID assertion_id {};
     const auto result {IOPMAssertionCreateWithName(kIOPMAssertPreventUserIdleDisplaySleep, kIOPMAssertionLevelOn, assertion_reason.get(), &assertion_id)};
     if (result != kIOReturnSuccess) {
-      DD_LOG(error) << "Failed to create macOS display sleep assertion: " << result;
+      DD_LOG_CAT(power, error) << "Failed to create macOS display sleep assertion: " << result;
       return std::nullopt;
     }
 
@@ -569,7 +569,7 @@ namespace display_device {
   bool MacApiLayer::releasePowerAssertion(const MacPowerAssertionId assertion_id) {
     const auto result {IOPMAssertionRelease(assertion_id)};
     if (result != kIOReturnSuccess) {
-      DD_LOG(error) << "Failed to release macOS power assertion " << assertion_id << ": " << result;
+      DD_LOG_CAT(power, error) << "Failed to release macOS power assertion " << assertion_id << ": " << result;
       return false;
     }
 
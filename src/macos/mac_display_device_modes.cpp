@@ -57,7 +57,7 @@ namespace display_device {
 
   MacDeviceDisplayModeMap MacDisplayDevice::getCurrentDisplayModes(const StringSet &device_ids) const {
     if (device_ids.empty()) {
-      DD_LOG(error) << "Device id set is empty!";
+      DD_LOG_CAT(modes, error) << "Device id set is empty!";
       return {};
     }
 
@@ -65,13 +65,13 @@ namespace display_device {
     for (const auto &device_id : device_ids) {
       const auto display_id {getDisplayId(device_id, MacQueryType::Active)};
       if (!display_id.has_value()) {
-        DD_LOG(error) << "Failed to find active macOS display for " << device_id << "!";
+        DD_LOG_CAT(modes, error) << "Failed to find active macOS display for " << device_id << "!";
         return {};
       }
 
       const auto current_mode {m_m_api->getCurrentDisplayMode(*display_id)};
       if (!current_mode) {
-        DD_LOG(error) << "Failed to get current macOS display mode for " << device_id << "!";
+        DD_LOG_CAT(modes, error) << "Failed to get current macOS display mode for " << device_id << "!";
         return {};
       }
 
@@ -83,7 +83,7 @@ namespace display_device {
 
   bool MacDisplayDevice::setDisplayModes(const MacDeviceDisplayModeMap &modes) {
     if (modes.empty()) {
-      DD_LOG(error) << "Modes map is empty!";
+      DD_LOG_CAT(modes, error) << "Modes map is empty!";
       return false;
     }
 
@@ -91,24 +91,24 @@ namespace display_device {
     MacDeviceDisplayModeMap original_modes;
     for (const auto &[device_id, mode] : modes) {
       if (device_id.empty()) {
-        DD_LOG(error) << "Device id is empty!";
+        DD_LOG_CAT(modes, error) << "Device id is empty!";
         return false;
       }
 
       const auto display_id {getDisplayId(device_id, MacQueryType::Active)};
       if (!display_id.has_value()) {
-        DD_LOG(error) << "Failed to find active macOS display for " << device_id << "!";
+        DD_LOG_CAT(modes, error) << "Failed to find active macOS display for " << device_id << "!";
         return false;
       }
 
       const auto current_mode {m_m_api->getCurrentDisplayMode(*display_id)};
       if (!current_mode) {
-        DD_LOG(error) << "Failed to get current macOS display mode for " << device_id << "!";
+        DD_LOG_CAT(modes, error) << "Failed to get current macOS display mode for " << device_id << "!";
         return false;
       }
 
       if (!isRequestedModeAvailable(*m_m_api, *display_id, *current_mode, mode)) {
-        DD_LOG(error) << "Requested macOS display mode is not available for " << device_id << "!";
+        DD_LOG_CAT(modes, error) << "Requested macOS display mode is not available for " << device_id << "!";
         return false;
       }
 
@@ -124,13 +124,13 @@ namespace display_device {
 
       const auto display_id {display_ids.at(device_id)};
       if (!m_m_api->setDisplayMode(display_id, mode)) {
-        DD_LOG(error) << "Failed to set macOS display mode for " << device_id << "!";
+        DD_LOG_CAT(modes, error) << "Failed to set macOS display mode for " << device_id << "!";
         rollbackChangedModes(*this, changed_modes);
         return false;
       }
 
       if (const auto verified_mode {m_m_api->getCurrentDisplayMode(display_id)}; !verified_mode || !mac_utils::fuzzyCompareModes(*verified_mode, mode)) {
-        DD_LOG(error) << "Failed to verify macOS display mode for " << device_id << "!";
+        DD_LOG_CAT(modes, error) << "Failed to verify macOS display mode for " << device_id << "!";
         changed_modes[device_id] = original_modes.at(device_id);
         rollbackChangedModes(*this, changed_modes);
         return false;
@@ -140,7 +140,7 @@ namespace display_device {
     }
 
     if (changed_modes.empty()) {
-      DD_LOG(debug) << "No changes were made to macOS display modes as they are equal.";
+      DD_LOG_CAT(modes, debug) << "No changes were made to macOS display modes as they are equal.";
     }
 
     return true;
@@ -10,7 +10,6 @@
 
 // local includes
 #include "display_device/detail/persistent_state_utils.h"
-#include "display_device/logging.h"
 #include "display_device/macos/json.h"
 #include "display_device/noop_settings_persistence.h"
 
@@ -25,51 +24,53 @@ namespace display_device {
     };
   }  // namespace
 
-  MacPersistentState::MacPersistentState(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api, const bool throw_on_load_error):
-      m_settings_persistence_api {std::move(settings_persistence_api)} {
+  MacPersistentState::MacPersistentState(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api, const bool throw_on_load_error, const PersistenceEncoding encoding, const PersistenceLoadMode load_mode):
+      m_settings_persistence_api {std::move(settings_persistence_api)},
+      m_encoding {encoding},
+      m_throw_on_load_error {throw_on_load_error} {
     if (!m_settings_persistence_api) {
       m_settings_persistence_api = std::make_shared<NoopSettingsPersistence>();
     }
 
-    std::string error_message;
-    if (const auto persistent_settings {m_settings_persistence_api->load()}) {
-      if (!persistent_settings->empty()) {
-        m_cached_state = MacSingleDisplayConfigState {};
-        if (!fromJson({std::begin(*persistent_settings), std::end(*persistent_settings)}, *m_cached_state, &error_message)) {
-          error_message = "Failed to parse macOS persistent settings! Error:\n" + error_message;
-        }
-      }
-    } else {
-      error_message = "Failed to load macOS persistent settings!";
-    }
-
-    if (!error_message.empty()) {
-      if (throw_on_load_error) {
-        throw MacPersistentStateLoadException {error_message};
-      }
-
-      DD_LOG(error) << error_message;
-      m_cached_state = std::nullopt;
+    if (load_mode == PersistenceLoadMode::Eager) {
+      ensureLoaded();
     }
   }
 
   bool MacPersistentState::persistState(const std::optional<MacSingleDisplayConfigState> &state) {
+    ensureLoaded();
     return detail::persistState(
       *m_settings_persistence_api,
       m_cached_state,
       state,
-      [](const MacSingleDisplayConfigState &state_to_serialize, bool &success) {
-        return toJson(state_to_serialize, 2, &success);
+      [this](const MacSingleDisplayConfigState &state_to_serialize, std::string &error_message) {
+        return detail::encodeState(state_to_serialize, m_encoding, error_message);
       },
       "Failed to serialize new macOS persistent state! Error:"
     );
   }
 
   const std::optional<MacSingleDisplayConfigState> &MacPersistentState::getState() const {
+    ensureLoaded();
     return m_cached_state;
   }
 
   const std::shared_ptr<SettingsPersistenceInterface> &MacPersistentState::getSettingsPersistenceApi() const {
     return m_settings_persistence_api;
   }
+
+  void MacPersistentState::ensureLoaded() const {
+    if (m_loaded) {
+      return;
+    }
+
+    // The cached state is only assigned once the load succeeds, so that a throwing load leaves nothing behind for the retry.
+    m_cached_state = detail::loadState<MacSingleDisplayConfigState, MacPersistentStateLoadException>(
+      *m_settings_persistence_api,
+      m_throw_on_load_error,
+      "Failed to load macOS persistent settings!",
+      "Failed to parse macOS persistent settings! Error:"
+    );
+    m_loaded = true;
+  }
 }  // namespace display_device
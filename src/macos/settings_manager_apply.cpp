@@ -15,6 +15,7 @@
 #include "display_device/logging.h"
 #include "display_device/macos/json.h"
 #include "display_device/macos/settings_utils.h"
+#include "display_device/trace_sink.h"
 
 namespace display_device {
   namespace {
@@ -111,7 +112,7 @@ namespace display_device {
       const auto topology_before_changes {dd_api.getCurrentTopology()};
       if (!dd_api.isTopologyValid(topology_before_changes)) {
         DD_LOG(error) << "Retrieved current macOS topology is invalid:\n"
-                      << toJson(topology_before_changes);
+                      << jsonView(topology_before_changes);
         return std::nullopt;
       }
 
@@ -139,7 +140,7 @@ namespace display_device {
       };
 
       if (!isActiveDevice(devices, device_to_configure) || !mac_utils::flattenTopology(topology_before_changes).contains(device_to_configure)) {
-        DD_LOG(error) << "macOS device " << toJson(device_to_configure, JSON_COMPACT) << " is not active!";
+        DD_LOG(error) << "macOS device " << jsonView(device_to_configure, JSON_COMPACT) << " is not active!";
         return std::nullopt;
       }
 
@@ -172,7 +173,7 @@ namespace display_device {
       }
 
       DD_LOG(info) << "Changing macOS display modes to:\n"
-                   << toJson(new_modes);
+                   << jsonView(new_modes);
       if (!dd_api.setDisplayModes(new_modes)) {
         return false;
       }
@@ -265,14 +266,15 @@ namespace display_device {
     using enum SettingsManagerInterface::ApplyResult;
 
     const auto api_access {m_dd_api->isApiAccessAvailable()};
-    DD_LOG(info) << "Trying to apply macOS display device settings. API is available: " << toJson(api_access);
+    DD_LOG(info) << "Trying to apply macOS display device settings. API is available: " << jsonView(api_access);
+    DD_TRACE("applySettings: device={}, device_prep={}, api_access={}", config.m_device_id, config.m_device_prep, api_access);
 
     if (!api_access) {
       return ApiTemporarilyUnavailable;
     }
 
     DD_LOG(info) << "Using the following macOS configuration:\n"
-                 << toJson(config);
+                 << jsonView(config);
 
     if (config.m_hdr_state) {
       return HdrStatePrepFailed;
@@ -288,9 +290,11 @@ namespace display_device {
     if (!apply_plan) {
       return DevicePrepFailed;
     }
+    DD_TRACE("applySettings: plan prepared, device_to_configure={}, additional_devices={}", apply_plan->m_device_to_configure, apply_plan->m_additional_devices_to_configure.size());
 
     ModeRollbackState mode_rollback;
     if (const auto mode_result {applyDisplayModes(*m_dd_api, config, *apply_plan, mode_rollback)}; mode_result != Ok) {
+      DD_TRACE("applySettings: display modes failed, result={}", mode_result);
       return mode_result;
     }
 
@@ -302,6 +306,7 @@ namespace display_device {
       return PersistenceSaveFailed;
     }
 
+    DD_TRACE("applySettings: done");
     return Ok;
   }
 }  // namespace display_device
@@ -23,19 +23,19 @@ namespace display_device {
 
     const auto current_topology {m_dd_api->getCurrentTopology()};
     if (!m_dd_api->isTopologyValid(current_topology)) {
-      DD_LOG(error) << "Retrieved current macOS topology is invalid:\n"
-                    << toJson(current_topology);
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Retrieved current macOS topology is invalid:\n"
+                                                  << jsonView(current_topology);
       return RevertResult::TopologyIsInvalid;
     }
 
     if (!m_dd_api->isTopologyValid(cached_state->m_modified.m_topology)) {
-      DD_LOG(error) << "Trying to revert macOS modes using invalid modified topology:\n"
-                    << toJson(cached_state->m_modified.m_topology);
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Trying to revert macOS modes using invalid modified topology:\n"
+                                                  << jsonView(cached_state->m_modified.m_topology);
       return RevertResult::TopologyIsInvalid;
     }
 
     if (!m_dd_api->isTopologyTheSame(current_topology, cached_state->m_modified.m_topology)) {
-      DD_LOG(error) << "Cannot revert macOS display modes because topology changes are not supported in phase 2.";
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Cannot revert macOS display modes because topology changes are not supported in phase 2.";
       return RevertResult::SwitchingTopologyFailed;
     }
 
@@ -43,12 +43,12 @@ namespace display_device {
     MacDeviceDisplayModeMap modes_to_restore;
 
     if (!cached_state->m_modified.m_original_hdr_states.empty()) {
-      DD_LOG(error) << "Cannot revert macOS HDR state because HDR mutations are unsupported.";
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Cannot revert macOS HDR state because HDR mutations are unsupported.";
       return RevertResult::RevertingHdrStatesFailed;
     }
 
     if (!cached_state->m_modified.m_original_primary_device.empty()) {
-      DD_LOG(error) << "Cannot revert macOS primary display because primary mutations are unsupported in phase 2.";
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Cannot revert macOS primary display because primary mutations are unsupported in phase 2.";
       return RevertResult::RevertingPrimaryDeviceFailed;
     }
 
@@ -56,13 +56,13 @@ namespace display_device {
       const auto mode_devices {mac_utils::flattenTopology(cached_state->m_modified.m_topology)};
       const auto current_modes {m_dd_api->getCurrentDisplayModes(mode_devices)};
       if (current_modes.empty()) {
-        DD_LOG(error) << "Failed to get current macOS display modes for revert!";
+        DD_LOG_LIMITED(error, m_revert_log_limiter) << "Failed to get current macOS display modes for revert!";
         return RevertResult::RevertingDisplayModesFailed;
       }
 
       if (current_modes != cached_state->m_modified.m_original_modes) {
         DD_LOG(info) << "Trying to change back macOS display modes to:\n"
-                     << toJson(cached_state->m_modified.m_original_modes);
+                     << jsonView(cached_state->m_modified.m_original_modes);
         if (!m_dd_api->setDisplayModes(cached_state->m_modified.m_original_modes)) {
           return RevertResult::RevertingDisplayModesFailed;
         }
@@ -73,7 +73,7 @@ namespace display_device {
     }
 
     if (!m_persistence_state->persistState(std::nullopt)) {
-      DD_LOG(error) << "Failed to clear reverted macOS display settings! Undoing mode changes...";
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Failed to clear reverted macOS display settings! Undoing mode changes...";
       if (rollback_modes_on_failure) {
         static_cast<void>(m_dd_api->setDisplayModes(modes_to_restore));
       }
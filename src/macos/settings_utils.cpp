@@ -178,11 +178,11 @@ namespace display_device::mac_utils {
 
   MacDdGuardFn modeGuardFn(MacDisplayDeviceInterface &mac_dd, const MacDeviceDisplayModeMap &modes) {
     DD_LOG(debug) << "Got macOS modes in modeGuardFn:\n"
-                  << toJson(modes);
+                  << jsonView(modes);
     return [&mac_dd, modes]() {
       if (!mac_dd.setDisplayModes(modes)) {
         DD_LOG(error) << "Failed to revert macOS display modes in modeGuardFn! Used the following modes:\n"
-                      << toJson(modes);
+                      << jsonView(modes);
       }
     };
   }
@@ -17,7 +17,7 @@ namespace display_device {
     return std::make_unique<SettingsManager>(
       std::make_shared<WinDisplayDevice>(api_layer),
       config.m_audio_context_api,
-      std::make_unique<PersistentState>(config.m_settings_persistence_api, config.m_throw_on_persistence_load_error),
+      std::make_unique<PersistentState>(config.m_settings_persistence_api, config.m_throw_on_persistence_load_error, config.m_persistence_encoding, config.m_persistence_load_mode),
       WinWorkarounds {
         .m_hdr_blank_delay = config.m_hdr_blank_delay
       }
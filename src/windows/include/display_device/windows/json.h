@@ -14,5 +14,6 @@ namespace display_device {
   DD_JSON_DECLARE_CONVERTER(DeviceDisplayModeMap)
   DD_JSON_DECLARE_CONVERTER(HdrStateMap)
   DD_JSON_DECLARE_CONVERTER(SingleDisplayConfigState)
+  DD_JSON_DECLARE_CBOR_CONVERTER(SingleDisplayConfigState)
   DD_JSON_DECLARE_CONVERTER(WinWorkarounds)
 }  // namespace display_device
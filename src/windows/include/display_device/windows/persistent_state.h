@@ -20,12 +20,15 @@ namespace display_device {
     /**
      * Default constructor for the class.
      * @param settings_persistence_api [Optional] A pointer to the Settings Persistence interface.
-     * @param throw_on_load_error Specify whether to throw exception in constructor in case settings fail to load.
+     * @param throw_on_load_error Specify whether to throw exception in case settings fail to load (in constructor or on the first access, depending on the load mode).
+     * @param encoding Encoding for storing the state. The stored state is loaded regardless of its encoding.
+     * @param load_mode Specify whether to load the state in constructor or on the first access.
      */
-    explicit PersistentState(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api, bool throw_on_load_error = false);
+    explicit PersistentState(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api, bool throw_on_load_error = false, PersistenceEncoding encoding = PersistenceEncoding::Json, PersistenceLoadMode load_mode = PersistenceLoadMode::Eager);
 
     /**
      * @brief Store the new state via the interface and cache it.
+     * @note Loads the stored state first, if it has not been loaded yet.
      * @param state New state to be set.
      * @return True if the state was succesfully updated, false otherwise.
      */
@@ -33,6 +36,7 @@ namespace display_device {
 
     /**
      * @brief Get cached state.
+     * @note Loads the stored state first, if it has not been loaded yet.
      * @return Cached state
      */
     [[nodiscard]] const std::optional<SingleDisplayConfigState> &getState() const;
@@ -44,7 +48,16 @@ namespace display_device {
     [[nodiscard]] const std::shared_ptr<SettingsPersistenceInterface> &getSettingsPersistenceApi() const;
 
   private:
+    /**
+     * @brief Load and parse the stored state, unless it is already loaded.
+     * @throws std::runtime_error if the state fails to load and throwing is enabled. The load is retried on the next access.
+     */
+    void ensureLoaded() const;
+
     std::shared_ptr<SettingsPersistenceInterface> m_settings_persistence_api;
-    std::optional<SingleDisplayConfigState> m_cached_state;
+    mutable std::optional<SingleDisplayConfigState> m_cached_state;
+    PersistenceEncoding m_encoding;
+    bool m_throw_on_load_error;
+    mutable bool m_loaded {false};
   };
 }  // namespace display_device
@@ -11,6 +11,7 @@
 
 // local includes
 #include "display_device/logging.h"
+#include "display_device/trace_sink.h"
 #include "display_device/windows/json.h"
 #include "display_device/windows/settings_utils.h"
 
@@ -26,22 +27,23 @@ namespace display_device {
 
   SettingsManager::ApplyResult SettingsManager::applySettings(const SingleDisplayConfiguration &config) {
     const auto api_access {m_dd_api->isApiAccessAvailable()};
-    DD_LOG(info) << "Trying to apply display device settings. API is available: " << toJson(api_access);
+    DD_LOG(info) << "Trying to apply display device settings. API is available: " << jsonView(api_access);
+    DD_TRACE("applySettings: device={}, device_prep={}, api_access={}", config.m_device_id, config.m_device_prep, api_access);
 
     if (!api_access) {
       return ApplyResult::ApiTemporarilyUnavailable;
     }
     DD_LOG(info) << "Using the following configuration:\n"
-                 << toJson(config);
+                 << jsonView(config);
 
     const auto topology_before_changes {m_dd_api->getCurrentTopology()};
     if (!m_dd_api->isTopologyValid(topology_before_changes)) {
       DD_LOG(error) << "Retrieved current topology is invalid:\n"
-                    << toJson(topology_before_changes);
+                    << jsonView(topology_before_changes);
       return ApplyResult::DevicePrepFailed;
     }
     DD_LOG(info) << "Active topology before any changes:\n"
-                 << toJson(topology_before_changes);
+                 << jsonView(topology_before_changes);
 
     bool system_settings_touched {false};
     boost::scope::scope_exit hdr_blank_always_executed_guard {[this, &system_settings_touched]() {
@@ -76,6 +78,7 @@ namespace display_device {
       return ApplyResult::DevicePrepFailed;
     }
     auto [new_state, device_to_configure, additional_devices_to_configure] = *prepped_topology_data;
+    DD_TRACE("applySettings: topology prepared, device_to_configure={}, additional_devices={}, release_context={}", device_to_configure, additional_devices_to_configure.size(), release_context);
 
     DdGuardFn primary_guard_fn {noopFn};
     boost::scope::scope_exit<DdGuardFn &> primary_guard {primary_guard_fn};
@@ -115,6 +118,7 @@ namespace display_device {
     primary_guard.set_active(false);
     mode_guard.set_active(false);
     hdr_state_guard.set_active(false);
+    DD_TRACE("applySettings: done");
     return ApplyResult::Ok;
   }
 
@@ -125,7 +129,7 @@ namespace display_device {
       return std::nullopt;
     }
     DD_LOG(info) << "Currently available devices:\n"
-                 << toJson(devices);
+                 << jsonView(devices);
 
     if (!config.m_device_id.empty()) {
       auto device_it {std::ranges::find_if(devices, [device_id = config.m_device_id](const auto &item) {
@@ -157,14 +161,14 @@ namespace display_device {
     const auto &[new_topology, device_to_configure, additional_devices_to_configure] = win_utils::computeNewTopologyAndMetadata(config.m_device_prep, config.m_device_id, *stripped_initial_state);
     const auto change_is_needed {!m_dd_api->isTopologyTheSame(topology_before_changes, new_topology)};
     DD_LOG(info) << "Newly computed display device topology data:\n"
-                 << "  - topology: " << toJson(new_topology, JSON_COMPACT) << "\n"
-                 << "  - change is needed: " << toJson(change_is_needed, JSON_COMPACT) << "\n"
-                 << "  - additional devices to configure: " << toJson(additional_devices_to_configure, JSON_COMPACT);
+                 << "  - topology: " << jsonView(new_topology, JSON_COMPACT) << "\n"
+                 << "  - change is needed: " << jsonView(change_is_needed, JSON_COMPACT) << "\n"
+                 << "  - additional devices to configure: " << jsonView(additional_devices_to_configure, JSON_COMPACT);
 
     // This check is mainly to cover the case for "config.device_prep == VerifyOnly" as we at least
     // have to validate that the device exists, but it doesn't hurt to double-check it in all cases.
     if (!win_utils::flattenTopology(new_topology).contains(device_to_configure)) {
-      DD_LOG(error) << "Device " << toJson(device_to_configure, JSON_COMPACT) << " is not active!";
+      DD_LOG(error) << "Device " << jsonView(device_to_configure, JSON_COMPACT) << " is not active!";
       return std::nullopt;
     }
 
@@ -215,7 +219,7 @@ namespace display_device {
       current_primary_device = win_utils::getPrimaryDevice(*m_dd_api, new_state.m_modified.m_topology);
       if (current_primary_device.empty()) {
         DD_LOG(error) << "Failed to get primary device for the topology! Searched topology:\n"
-                      << toJson(new_state.m_modified.m_topology);
+                      << jsonView(new_state.m_modified.m_topology);
         return false;
       }
     }
@@ -225,7 +229,7 @@ namespace display_device {
       if (current_primary_device != new_device) {
         system_settings_touched = true;
 
-        DD_LOG(info) << info_preamble << toJson(new_device);
+        DD_LOG(info) << info_preamble << jsonView(new_device);
         if (!dd_api.setAsPrimary(new_device)) {
           DD_LOG(error) << error_log;
           return false;
@@ -276,7 +280,7 @@ namespace display_device {
     auto &dd_api {*m_dd_api};
     const auto try_change {[&current_display_modes, &dd_api, &guard_fn, &new_state, &system_settings_touched](const DeviceDisplayModeMap &new_modes, const auto info_preamble, const auto error_log) {
       if (current_display_modes != new_modes) {
-        DD_LOG(info) << info_preamble << toJson(new_modes);
+        DD_LOG(info) << info_preamble << jsonView(new_modes);
         if (!dd_api.setDisplayModes(new_modes)) {
           system_settings_touched = true;
           DD_LOG(error) << error_log;
@@ -338,7 +342,7 @@ namespace display_device {
       if (current_hdr_states != new_states) {
         system_settings_touched = true;
 
-        DD_LOG(info) << info_preamble << toJson(new_states);
+        DD_LOG(info) << info_preamble << jsonView(new_states);
         if (!dd_api.setHdrStates(new_states)) {
           DD_LOG(error) << error_log;
           return false;
@@ -37,7 +37,7 @@ namespace display_device {
     }
 
     DD_LOG(info) << "Provided workaround settings for SettingsManager:\n"
-                 << toJson(m_workarounds);
+                 << jsonView(m_workarounds);
   }
 
   EnumeratedDeviceList SettingsManager::enumAvailableDevices() const {
@@ -30,7 +30,7 @@ namespace display_device {
     }
 
     const auto api_access {m_dd_api->isApiAccessAvailable()};
-    DD_LOG(info) << "Trying to revert applied display device settings. API is available: " << toJson(api_access);
+    DD_LOG_LIMITED(info, m_revert_log_limiter) << "Trying to revert applied display device settings. API is available: " << jsonView(api_access);
 
     if (!api_access) {
       return RevertResult::ApiTemporarilyUnavailable;
@@ -38,8 +38,8 @@ namespace display_device {
 
     const auto current_topology {m_dd_api->getCurrentTopology()};
     if (!m_dd_api->isTopologyValid(current_topology)) {
-      DD_LOG(error) << "Retrieved current topology is invalid:\n"
-                    << toJson(current_topology);
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Retrieved current topology is invalid:\n"
+                                                  << jsonView(current_topology);
       return RevertResult::TopologyIsInvalid;
     }
 
@@ -58,8 +58,8 @@ namespace display_device {
       const bool is_topology_the_same {m_dd_api->isTopologyTheSame(current_topology, topology_to_restore)};
       system_settings_touched = system_settings_touched || !is_topology_the_same;
       if (!is_topology_the_same && !m_dd_api->setTopology(topology_to_restore)) {
-        DD_LOG(error) << "failed to revert topology in revertSettings topology guard! Used the following topology:\n"
-                      << toJson(topology_to_restore);
+        DD_LOG_LIMITED(error, m_revert_log_limiter) << "failed to revert topology in revertSettings topology guard! Used the following topology:\n"
+                                                    << jsonView(topology_to_restore);
       }
     }};
 
@@ -71,8 +71,8 @@ namespace display_device {
     }
 
     if (!m_dd_api->isTopologyValid(cached_state->m_initial.m_topology)) {
-      DD_LOG(error) << "Trying to revert to an invalid initial topology:\n"
-                    << toJson(cached_state->m_initial.m_topology);
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Trying to revert to an invalid initial topology:\n"
+                                                  << jsonView(cached_state->m_initial.m_topology);
       return RevertResult::TopologyIsInvalid;
     }
 
@@ -80,13 +80,13 @@ namespace display_device {
     const bool need_to_switch_topology {!is_topology_the_same || switched_to_modified_topology};
     system_settings_touched = system_settings_touched || !is_topology_the_same;
     if (need_to_switch_topology && !m_dd_api->setTopology(cached_state->m_initial.m_topology)) {
-      DD_LOG(error) << "Failed to change topology to:\n"
-                    << toJson(cached_state->m_initial.m_topology);
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Failed to change topology to:\n"
+                                                  << jsonView(cached_state->m_initial.m_topology);
       return RevertResult::SwitchingTopologyFailed;
     }
 
     if (!m_persistence_state->persistState(std::nullopt)) {
-      DD_LOG(error) << "Failed to save reverted settings! Undoing initial topology changes...";
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Failed to save reverted settings! Undoing initial topology changes...";
       return RevertResult::PersistenceSaveFailed;
     }
 
@@ -114,7 +114,7 @@ namespace display_device {
     system_settings_touched = true;
 
     DD_LOG(info) << "Trying to change back the HDR states to:\n"
-                 << toJson(modified_state.m_original_hdr_states);
+                 << jsonView(modified_state.m_original_hdr_states);
     if (!m_dd_api->setHdrStates(modified_state.m_original_hdr_states)) {
       // Error already logged
       return RevertingHdrStatesFailed;
@@ -137,7 +137,7 @@ namespace display_device {
     }
 
     DD_LOG(info) << "Trying to change back the display modes to:\n"
-                 << toJson(modified_state.m_original_modes);
+                 << jsonView(modified_state.m_original_modes);
     if (!m_dd_api->setDisplayModes(modified_state.m_original_modes)) {
       system_settings_touched = true;
       // Error already logged
@@ -169,7 +169,7 @@ namespace display_device {
 
     system_settings_touched = true;
 
-    DD_LOG(info) << "Trying to change back the original primary device to: " << toJson(modified_state.m_original_primary_device);
+    DD_LOG(info) << "Trying to change back the original primary device to: " << jsonView(modified_state.m_original_primary_device);
     if (!m_dd_api->setAsPrimary(modified_state.m_original_primary_device)) {
       // Error already logged
       return RevertingPrimaryDeviceFailed;
@@ -186,16 +186,16 @@ namespace display_device {
     }
 
     if (!m_dd_api->isTopologyValid(cached_state->m_modified.m_topology)) {
-      DD_LOG(error) << "Trying to revert modified settings using invalid topology:\n"
-                    << toJson(cached_state->m_modified.m_topology);
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Trying to revert modified settings using invalid topology:\n"
+                                                  << jsonView(cached_state->m_modified.m_topology);
       return RevertResult::TopologyIsInvalid;
     }
 
     const bool is_topology_the_same {m_dd_api->isTopologyTheSame(current_topology, cached_state->m_modified.m_topology)};
     system_settings_touched = !is_topology_the_same;
     if (!is_topology_the_same && !m_dd_api->setTopology(cached_state->m_modified.m_topology)) {
-      DD_LOG(error) << "Failed to change topology to:\n"
-                    << toJson(cached_state->m_modified.m_topology);
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Failed to change topology to:\n"
+                                                  << jsonView(cached_state->m_modified.m_topology);
       return RevertResult::SwitchingTopologyFailed;
     }
     if (switched_topology) {
@@ -226,7 +226,7 @@ namespace display_device {
     auto cleared_data {*cached_state};
     cleared_data.m_modified = {cleared_data.m_modified.m_topology};
     if (!m_persistence_state->persistState(cleared_data)) {
-      DD_LOG(error) << "Failed to save reverted settings! Undoing changes to modified topology...";
+      DD_LOG_LIMITED(error, m_revert_log_limiter) << "Failed to save reverted settings! Undoing changes to modified topology...";
       return RevertResult::PersistenceSaveFailed;
     }
 
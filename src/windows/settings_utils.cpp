@@ -200,11 +200,11 @@ namespace display_device::win_utils {
     const auto device_to_configure {configuring_unspecified_devices ? *std::begin(initial_state.m_primary_devices) : device_id};
     auto additional_devices_to_configure {configuring_unspecified_devices ? StringSet {std::next(std::begin(initial_state.m_primary_devices)), std::end(initial_state.m_primary_devices)} : tryGetOtherDevicesInTheSameGroup(initial_state.m_topology, device_to_configure)};
     DD_LOG(info) << "Will compute new display device topology from the following input:\n"
-                 << "  - initial topology: " << toJson(initial_state.m_topology, JSON_COMPACT) << "\n"
-                 << "  - initial primary devices: " << toJson(initial_state.m_primary_devices, JSON_COMPACT) << "\n"
-                 << "  - configuring unspecified device: " << toJson(configuring_unspecified_devices, JSON_COMPACT) << "\n"
-                 << "  - device to configure: " << toJson(device_to_configure, JSON_COMPACT) << "\n"
-                 << "  - additional devices to configure: " << toJson(additional_devices_to_configure, JSON_COMPACT);
+                 << "  - initial topology: " << jsonView(initial_state.m_topology, JSON_COMPACT) << "\n"
+                 << "  - initial primary devices: " << jsonView(initial_state.m_primary_devices, JSON_COMPACT) << "\n"
+                 << "  - configuring unspecified device: " << jsonView(configuring_unspecified_devices, JSON_COMPACT) << "\n"
+                 << "  - device to configure: " << jsonView(device_to_configure, JSON_COMPACT) << "\n"
+                 << "  - additional devices to configure: " << jsonView(additional_devices_to_configure, JSON_COMPACT);
 
     const auto new_topology {computeNewTopology(device_prep, configuring_unspecified_devices, device_to_configure, additional_devices_to_configure, initial_state.m_topology)};
     additional_devices_to_configure = tryGetOtherDevicesInTheSameGroup(new_topology, device_to_configure);
@@ -300,7 +300,7 @@ namespace display_device::win_utils {
     const auto current_states {win_dd.getCurrentHdrStates(flattenTopology(topology))};
     if (current_states.empty()) {
       DD_LOG(error) << "Failed to get current HDR states! Topology:\n"
-                    << toJson(topology);
+                    << jsonView(topology);
       return;
     }
 
@@ -323,7 +323,7 @@ namespace display_device::win_utils {
       return;
     }
 
-    DD_LOG(info) << "Applying HDR state \"blank\" workaround (" << delay->count() << "ms) to devices: " << toJson(device_ids, JSON_COMPACT);
+    DD_LOG(info) << "Applying HDR state \"blank\" workaround (" << delay->count() << "ms) to devices: " << jsonView(device_ids, JSON_COMPACT);
     if (!win_dd.setHdrStates(inverse_states)) {
       DD_LOG(error) << "Failed to apply inverse HDR states during \"blank\"!";
       return;
@@ -337,11 +337,11 @@ namespace display_device::win_utils {
 
   DdGuardFn topologyGuardFn(WinDisplayDeviceInterface &win_dd, const ActiveTopology &topology) {
     DD_LOG(debug) << "Got topology in topologyGuardFn:\n"
-                  << toJson(topology);
+                  << jsonView(topology);
     return [&win_dd, topology]() {
       if (!win_dd.setTopology(topology)) {
         DD_LOG(error) << "failed to revert topology in topologyGuardFn! Used the following topology:\n"
-                      << toJson(topology);
+                      << jsonView(topology);
       }
     };
   }
@@ -352,11 +352,11 @@ namespace display_device::win_utils {
 
   DdGuardFn modeGuardFn(WinDisplayDeviceInterface &win_dd, const DeviceDisplayModeMap &modes) {
     DD_LOG(debug) << "Got modes in modeGuardFn:\n"
-                  << toJson(modes);
+                  << jsonView(modes);
     return [&win_dd, modes]() {
       if (!win_dd.setDisplayModes(modes)) {
         DD_LOG(error) << "failed to revert display modes in modeGuardFn! Used the following modes:\n"
-                      << toJson(modes);
+                      << jsonView(modes);
       }
     };
   }
@@ -367,11 +367,11 @@ namespace display_device::win_utils {
 
   DdGuardFn primaryGuardFn(WinDisplayDeviceInterface &win_dd, const std::string &primary_device) {
     DD_LOG(debug) << "Got primary device in primaryGuardFn:\n"
-                  << toJson(primary_device);
+                  << jsonView(primary_device);
     return [&win_dd, primary_device]() {
       if (!win_dd.setAsPrimary(primary_device)) {
         DD_LOG(error) << "failed to revert primary device in primaryGuardFn! Used the following device id:\n"
-                      << toJson(primary_device);
+                      << jsonView(primary_device);
       }
     };
   }
@@ -382,11 +382,11 @@ namespace display_device::win_utils {
 
   DdGuardFn hdrStateGuardFn(WinDisplayDeviceInterface &win_dd, const HdrStateMap &states) {
     DD_LOG(debug) << "Got states in hdrStateGuardFn:\n"
-                  << toJson(states);
+                  << jsonView(states);
     return [&win_dd, states]() {
       if (!win_dd.setHdrStates(states)) {
         DD_LOG(error) << "failed to revert HDR states in hdrStateGuardFn! Used the following HDR states:\n"
-                      << toJson(states);
+                      << jsonView(states);
       }
     };
   }
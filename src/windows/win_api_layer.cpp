@@ -531,7 +531,7 @@ namespace display_device {
 
   bool WinApiLayer::wakeDisplay(const std::chrono::milliseconds timeout) {
     if (const auto result {SetThreadExecutionState(ES_DISPLAY_REQUIRED)}; result == 0) {
-      DD_LOG(error) << getErrorString(static_cast<LONG>(GetLastError())) << " failed to wake display.";
+      DD_LOG_CAT(power, error) << getErrorString(static_cast<LONG>(GetLastError())) << " failed to wake display.";
       return false;
     }
 
@@ -545,7 +545,7 @@ namespace display_device {
 
   bool WinApiLayer::keepDisplayAwake() {
     if (const auto result {SetThreadExecutionState(ES_CONTINUOUS | ES_DISPLAY_REQUIRED)}; result == 0) {
-      DD_LOG(error) << getErrorString(static_cast<LONG>(GetLastError())) << " failed to request display keep-awake.";
+      DD_LOG_CAT(power, error) << getErrorString(static_cast<LONG>(GetLastError())) << " failed to request display keep-awake.";
       return false;
     }
 
@@ -554,7 +554,7 @@ namespace display_device {
 
   bool WinApiLayer::restorePowerRequest() {
     if (const auto result {SetThreadExecutionState(ES_CONTINUOUS)}; result == 0) {
-      DD_LOG(error) << getErrorString(static_cast<LONG>(GetLastError())) << " failed to restore display power request.";
+      DD_LOG_CAT(power, error) << getErrorString(static_cast<LONG>(GetLastError())) << " failed to restore display power request.";
       return false;
     }
 
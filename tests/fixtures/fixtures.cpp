@@ -18,8 +18,17 @@ void BaseTest::SetUp() {
 
 void BaseTest::TearDown() {
   if (!m_test_skipped_at_setup) {
-    // reset the callback to avoid potential leaks
+    // drain the asynchronous records (if any) and reset the callback to avoid potential leaks
+    display_device::Logger::get().disableAsyncMode();
+    display_device::Logger::get().disableDeduplication();
     display_device::Logger::get().setCustomCallback(nullptr);
+    display_device::Logger::get().setRecordCallback(nullptr);
+    display_device::Logger::get().setBatchCallback(nullptr, {});
+    display_device::Logger::get().setTraceSink(nullptr);
+    for (std::size_t i {0}; i < display_device::Logger::m_category_count; ++i) {
+      display_device::Logger::get().resetLogLevel(static_cast<display_device::Logger::LogCategory>(i));
+    }
+    display_device::Logger::get().setTimestampFormat(display_device::Logger::TimestampFormat::LocalTime);
   }
 
   ::lizardbyte::common::testing::BaseTest::TearDown();
@@ -1,5 +1,8 @@
 #pragma once
 
+// system includes
+#include <sstream>
+
 // local includes
 #include "display_device/json.h"
 #include "fixtures.h"
@@ -13,6 +16,12 @@ public:
     EXPECT_TRUE(success);
     EXPECT_EQ(json_string, expected_string);
 
+    for (const auto &indent : {std::optional<unsigned int> {}, std::optional<unsigned int> {2}}) {
+      std::ostringstream stream;
+      stream << display_device::jsonView(input, indent);
+      EXPECT_EQ(stream.str(), display_device::toJson(input, indent, nullptr));
+    }
+
     std::string error_message {};
     T defaulted_input {};
     if (!display_device::fromJson(json_string, defaulted_input, &error_message)) {
@@ -0,0 +1,103 @@
+// system includes
+#include <algorithm>
+#include <vector>
+
+// local includes
+#include "display_device/backoff_policy.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  using namespace std::chrono_literals;
+
+  // Test fixture(s) for this file
+  class BackoffPolicyTest: public BaseTest {
+  public:
+    static std::vector<std::chrono::milliseconds> takeDelays(const display_device::AnyBackoffPolicy &policy, const std::size_t count) {
+      display_device::BackoffState state;
+      std::vector<std::chrono::milliseconds> delays;
+      for (std::size_t i {0}; i < count; ++i) {
+        delays.push_back(policy.nextDelay(state));
+      }
+      return delays;
+    }
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, BackoffPolicyTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(Constant) {
+  const display_device::ConstantBackoff policy {5ms};
+  EXPECT_TRUE(policy.isValid());
+  EXPECT_EQ(takeDelays(policy, 3), (std::vector {5ms, 5ms, 5ms}));
+
+  EXPECT_FALSE((display_device::ConstantBackoff {0ms}.isValid()));
+}
+
+TEST_F_S(Linear) {
+  const display_device::LinearBackoff policy {.m_initial_delay = 10ms, .m_increment = 15ms, .m_max_delay = 50ms};
+  EXPECT_TRUE(policy.isValid());
+  EXPECT_EQ(takeDelays(policy, 5), (std::vector {10ms, 25ms, 40ms, 50ms, 50ms}));
+
+  EXPECT_FALSE((display_device::LinearBackoff {.m_initial_delay = 0ms, .m_increment = 1ms, .m_max_delay = 1ms}.isValid()));
+  EXPECT_FALSE((display_device::LinearBackoff {.m_initial_delay = 1ms, .m_increment = -1ms, .m_max_delay = 1ms}.isValid()));
+  EXPECT_FALSE((display_device::LinearBackoff {.m_initial_delay = 2ms, .m_increment = 1ms, .m_max_delay = 1ms}.isValid()));
+}
+
+TEST_F_S(Exponential) {
+  const display_device::ExponentialBackoff policy {.m_initial_delay = 100ms, .m_max_delay = 1000ms};
+  EXPECT_TRUE(policy.isValid());
+  EXPECT_EQ(takeDelays(policy, 6), (std::vector {100ms, 200ms, 400ms, 800ms, 1000ms, 1000ms}));
+
+  EXPECT_FALSE((display_device::ExponentialBackoff {.m_initial_delay = 0ms, .m_max_delay = 1ms}.isValid()));
+  EXPECT_FALSE((display_device::ExponentialBackoff {.m_initial_delay = 2ms, .m_max_delay = 1ms}.isValid()));
+  EXPECT_FALSE((display_device::ExponentialBackoff {.m_initial_delay = 1ms, .m_max_delay = 1ms, .m_multiplier = 0.5}.isValid()));
+  EXPECT_FALSE((display_device::ExponentialBackoff {.m_initial_delay = 1ms, .m_max_delay = 1ms, .m_jitter = 1.0}.isValid()));
+}
+
+TEST_F_S(Exponential, NoOverflow) {
+  const display_device::ExponentialBackoff policy {.m_initial_delay = 1ms, .m_max_delay = 5000ms, .m_multiplier = 10.0};
+  const auto delays {takeDelays(policy, 1000)};
+  EXPECT_EQ(delays.back(), 5000ms);
+}
+
+TEST_F_S(Exponential, Jitter) {
+  const display_device::ExponentialBackoff policy {.m_initial_delay = 100ms, .m_max_delay = 5000ms, .m_jitter = 0.2};
+  const auto delays {takeDelays(policy, 10)};
+
+  auto expected {100ms};
+  for (const auto delay : delays) {
+    EXPECT_GE(delay, expected * 8 / 10);
+    EXPECT_LE(delay, std::min(expected * 12 / 10, 5000ms));
+    expected = std::min(expected * 2, 5000ms);
+  }
+}
+
+TEST_F_S(Exponential, JitterAtMaxDelay) {
+  const display_device::ExponentialBackoff policy {.m_initial_delay = 1000ms, .m_max_delay = 1000ms, .m_jitter = 0.2};
+  const auto delays {takeDelays(policy, 200)};
+
+  for (const auto delay : delays) {
+    EXPECT_GE(delay, 800ms);
+    EXPECT_LE(delay, 1000ms);
+  }
+
+  // The capped delays are spread below the maximum instead of being clamped to it
+  EXPECT_LT(std::ranges::count(delays, 1000ms), 20);
+}
+
+TEST_F_S(DecorrelatedJitter) {
+  const display_device::DecorrelatedJitterBackoff policy {.m_base_delay = 10ms, .m_max_delay = 1000ms};
+  EXPECT_TRUE(policy.isValid());
+
+  display_device::BackoffState state;
+  for (int i {0}; i < 100; ++i) {
+    const auto previous_delay {state.m_attempt == 0 ? 10ms : state.m_previous_delay};
+    const auto delay {policy.nextDelay(state)};
+    EXPECT_GE(delay, 10ms);
+    EXPECT_LE(delay, std::min(previous_delay * 3, 1000ms));
+  }
+
+  EXPECT_FALSE((display_device::DecorrelatedJitterBackoff {.m_base_delay = 0ms, .m_max_delay = 1ms}.isValid()));
+  EXPECT_FALSE((display_device::DecorrelatedJitterBackoff {.m_base_delay = 2ms, .m_max_delay = 1ms}.isValid()));
+}
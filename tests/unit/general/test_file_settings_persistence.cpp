@@ -1,9 +1,11 @@
 // system includes
 #include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 #include <gmock/gmock.h>
 #include <stdexcept>
+#include <thread>
 
 // local includes
 #include "display_device/file_settings_persistence.h"
@@ -12,6 +14,7 @@
 namespace {
   // Convenience keywords for GMock
   using ::testing::HasSubstr;
+  using ::testing::IsEmpty;
 
   // Test fixture(s) for this file
   class FileSettingsPersistenceTest: public BaseTest {
@@ -19,17 +22,35 @@ namespace {
     ~FileSettingsPersistenceTest() override {
       std::error_code error_code;
       std::filesystem::remove_all(m_filepath, error_code);
+      for (const auto &temp_filepath : getTempFilepaths()) {
+        std::filesystem::remove_all(temp_filepath, error_code);
+      }
     }
 
-    display_device::FileSettingsPersistence &getImpl(const std::filesystem::path &filepath = "testfile.ext") {
+    display_device::FileSettingsPersistence &getImpl(const std::filesystem::path &filepath = "testfile.ext", const display_device::FileSettingsPersistence::StoreMode store_mode = display_device::FileSettingsPersistence::StoreMode::Durable) {
       if (!m_impl) {
         m_filepath = filepath;
-        m_impl = std::make_unique<display_device::FileSettingsPersistence>(m_filepath);
+        m_impl = std::make_unique<display_device::FileSettingsPersistence>(m_filepath, store_mode);
       }
 
       return *m_impl;
     }
 
+    std::vector<std::filesystem::path> getTempFilepaths() const {
+      const auto directory {m_filepath.parent_path().empty() ? std::filesystem::path {"."} : m_filepath.parent_path()};
+      const auto prefix {m_filepath.filename().string() + "."};
+
+      std::error_code error_code;
+      std::vector<std::filesystem::path> temp_filepaths;
+      for (const auto &entry : std::filesystem::directory_iterator {directory, error_code}) {
+        const auto filename {entry.path().filename().string()};
+        if (filename.starts_with(prefix) && filename.ends_with(".tmp")) {
+          temp_filepaths.push_back(entry.path());
+        }
+      }
+      return temp_filepaths;
+    }
+
   private:
     std::filesystem::path m_filepath;
     std::unique_ptr<display_device::FileSettingsPersistence> m_impl;
@@ -87,6 +108,113 @@ TEST_F_S(Store, FilepathWithDirectory) {
   EXPECT_FALSE(std::filesystem::exists(filepath));
 }
 
+TEST_F_S(Store, Durable, NoTemporaryFileLeft) {
+  const std::filesystem::path filepath {"myfile.ext"};
+  const std::vector<std::uint8_t> data {'S', 'O', 'M', 'E', ' ', 'D', 'A', 'T', 'A'};
+
+  EXPECT_TRUE(getImpl(filepath).store(data));
+  EXPECT_TRUE(std::filesystem::exists(filepath));
+  EXPECT_THAT(getTempFilepaths(), IsEmpty());
+  EXPECT_EQ(getImpl().load(), data);
+}
+
+TEST_F_S(Store, Durable, FailedReplaceKeepsTarget) {
+  const std::filesystem::path filepath {"settings-dir"};
+  const std::vector<std::uint8_t> data {'S', 'O', 'M', 'E', ' ', 'D', 'A', 'T', 'A'};
+
+  std::filesystem::create_directory(filepath);
+  {
+    std::ofstream file {filepath / "child.ext"};
+    file << "some data";
+  }
+
+  EXPECT_FALSE(getImpl(filepath).store(data));
+  EXPECT_TRUE(std::filesystem::is_directory(filepath));
+  EXPECT_THAT(getTempFilepaths(), IsEmpty());
+}
+
+TEST_F_S(Store, Direct, FileOverwritten) {
+  const std::filesystem::path filepath {"myfile.ext"};
+  const std::vector<std::uint8_t> data1 {'S', 'O', 'M', 'E', ' ', 'L', 'O', 'N', 'G', 'E', 'R', ' ', 'D', 'A', 'T', 'A'};
+  const std::vector<std::uint8_t> data2 {'S', 'O', 'M', 'E', ' ', 'D', 'A', 'T', 'A'};
+
+  auto &impl {getImpl(filepath, display_device::FileSettingsPersistence::StoreMode::Direct)};
+  EXPECT_TRUE(impl.store(data1));
+  EXPECT_TRUE(impl.store(data2));
+  EXPECT_THAT(getTempFilepaths(), IsEmpty());
+  EXPECT_EQ(impl.load(), data2);
+}
+
+TEST_F_S(Store, Direct, FilepathWithDirectory) {
+  const std::filesystem::path filepath {"somedir/myfile.ext"};
+
+  EXPECT_FALSE(getImpl(filepath, display_device::FileSettingsPersistence::StoreMode::Direct).store({'A'}));
+  EXPECT_FALSE(std::filesystem::exists(filepath));
+}
+
+TEST_F_S(Store, Durable, PermissionsKept) {
+  const std::filesystem::path filepath {"myfile.ext"};
+  const auto permissions {std::filesystem::perms::owner_read | std::filesystem::perms::owner_write | std::filesystem::perms::group_read};
+
+  auto &impl {getImpl(filepath)};
+  EXPECT_TRUE(impl.store({'A'}));
+  std::filesystem::permissions(filepath, permissions);
+
+  EXPECT_TRUE(impl.store({'B'}));
+  EXPECT_EQ(impl.load(), std::vector<std::uint8_t> {'B'});
+#ifndef _WIN32
+  EXPECT_EQ(std::filesystem::status(filepath).permissions(), permissions);
+#endif
+}
+
+TEST_F_S(Store, Durable, MultipleInstances) {
+  const std::filesystem::path filepath {"myfile.ext"};
+  const std::vector<std::uint8_t> data1 {'S', 'O', 'M', 'E', ' ', 'D', 'A', 'T', 'A'};
+  const std::vector<std::uint8_t> data2 {'O', 'T', 'H', 'E', 'R', ' ', 'D', 'A', 'T', 'A'};
+
+  auto &impl {getImpl(filepath)};
+  display_device::FileSettingsPersistence other_impl {filepath};
+
+  std::thread thread {[&other_impl, &data2]() {
+    EXPECT_TRUE(other_impl.store(data2));
+  }};
+  EXPECT_TRUE(impl.store(data1));
+  thread.join();
+
+  EXPECT_THAT(impl.load(), ::testing::AnyOf(data1, data2));
+  EXPECT_THAT(getTempFilepaths(), IsEmpty());
+}
+
+TEST_F_S(Store, ConcurrentStores) {
+  const std::filesystem::path filepath {"myfile.ext"};
+  auto &impl {getImpl(filepath)};
+
+  std::vector<std::vector<std::uint8_t>> data;
+  for (std::uint8_t i {0}; i < 8; ++i) {
+    data.push_back(std::vector<std::uint8_t>(1024, i));
+  }
+
+  std::atomic_int succeeded {0};
+  std::vector<std::thread> threads;
+  for (const auto &item : data) {
+    threads.emplace_back([&impl, &item, &succeeded]() {
+      if (impl.store(item)) {
+        succeeded++;
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(succeeded, 8);
+  EXPECT_THAT(data, ::testing::Contains(*impl.load()));
+  EXPECT_THAT(getTempFilepaths(), IsEmpty());
+
+  EXPECT_TRUE(impl.clear());
+  EXPECT_EQ(impl.load(), std::vector<std::uint8_t> {});
+}
+
 TEST_F_S(Load, NoFileAvailable) {
   EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {});
 }
@@ -110,6 +238,65 @@ TEST_F_S(Load, FilepathIsDirectory) {
   EXPECT_EQ(getImpl(filepath).load(), std::nullopt);
 }
 
+TEST_F_S(LoadView, NoFileAvailable) {
+  const auto view {getImpl().loadView()};
+  ASSERT_TRUE(view);
+  EXPECT_TRUE(view->empty());
+}
+
+TEST_F_S(LoadView, EmptyFile) {
+  const std::filesystem::path filepath {"myfile.ext"};
+  {
+    std::ofstream file {filepath};
+  }
+
+  const auto view {getImpl(filepath).loadView()};
+  ASSERT_TRUE(view);
+  EXPECT_TRUE(view->empty());
+}
+
+TEST_F_S(LoadView, SmallFileRead) {
+  const std::filesystem::path filepath {"myfile.ext"};
+  const std::vector<std::uint8_t> data {'S', 'O', 'M', 'E', ' ', 'D', 'A', 'T', 'A'};
+
+  {
+    std::ofstream file {filepath, std::ios_base::binary};
+    std::ranges::copy(data, std::ostreambuf_iterator<char> {file});
+  }
+
+  const auto view {getImpl(filepath).loadView()};
+  ASSERT_TRUE(view);
+  EXPECT_TRUE(std::ranges::equal(view->getData(), data));
+  EXPECT_EQ(view->getString(), "SOME DATA");
+}
+
+TEST_F_S(LoadView, LargeFile) {
+  const std::filesystem::path filepath {"myfile.ext"};
+  std::vector<std::uint8_t> data(256 * 1024);
+  for (std::size_t i {0}; i < data.size(); ++i) {
+    data[i] = static_cast<std::uint8_t>(i % 251);
+  }
+
+  auto &impl {getImpl(filepath)};
+  EXPECT_TRUE(impl.store(data));
+
+  const auto view {impl.loadView()};
+  ASSERT_TRUE(view);
+  EXPECT_TRUE(std::ranges::equal(view->getData(), data));
+
+  // The view owns the data, so it is not affected by the later stores
+  EXPECT_TRUE(impl.store({'N', 'E', 'W'}));
+  EXPECT_TRUE(std::ranges::equal(view->getData(), data));
+  EXPECT_EQ(impl.load(), (std::vector<std::uint8_t> {'N', 'E', 'W'}));
+}
+
+TEST_F_S(LoadView, FilepathIsDirectory) {
+  const std::filesystem::path filepath {"settings-dir"};
+
+  std::filesystem::create_directory(filepath);
+  EXPECT_FALSE(getImpl(filepath).loadView());
+}
+
 TEST_F_S(Clear, NoFileAvailable) {
   EXPECT_TRUE(getImpl().clear());
 }
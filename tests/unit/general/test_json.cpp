@@ -4,10 +4,15 @@
 #include "display_device/json.h"
 #include "display_device/detail/json_serializer.h"
 #include "display_device/detail/json_converter.h"
+#include "display_device/detail/persistent_state_utils.h"
 // clang-format on
 
+// system includes
+#include <sstream>
+
 // local includes
 #include "fixtures/fixtures.h"
+#include "fixtures/mock_settings_persistence.h"
 
 namespace display_device {
   enum class TestEnum {
@@ -88,6 +93,9 @@ namespace display_device {
   }
 
   DD_JSON_DEFINE_CONVERTER(TestThrowingStruct)
+
+  DD_JSON_DEFINE_CBOR_CONVERTER(TestStruct)
+  DD_JSON_DEFINE_CBOR_CONVERTER(TestThrowingStruct)
 }  // namespace display_device
 
 namespace {
@@ -106,6 +114,17 @@ namespace {
     EXPECT_TRUE(success);
   }
 
+  template<class T>
+  std::string streamJsonView(const T &input, const std::optional<unsigned int> &indent) {
+    std::ostringstream stream;
+    stream << display_device::jsonView(input, indent);
+    return stream.str();
+  }
+
+  std::optional<display_device::TestStruct> loadTestState(const display_device::SettingsPersistenceInterface &persistence, const bool throw_on_load_error) {
+    return display_device::detail::loadState<display_device::TestStruct, std::runtime_error>(persistence, throw_on_load_error, "Load failed!", "Parse failed!");
+  }
+
   template<class T>
   void expectInvalidJsonFailure() {
     const T original {};
@@ -409,3 +428,215 @@ TEST_S(FromJson, ChronoDuration, Ranges) {
   EXPECT_TRUE(display_device::fromJson(std::to_string(MAX_NANO_VAL), value, nullptr));
   EXPECT_EQ(value, std::chrono::nanoseconds {MAX_NANO_VAL});
 }
+
+TEST_S(JsonView, SameAsToJson, LocalConverterTypes) {
+  using namespace std::chrono;
+
+  const auto doTest {[](const auto &input) {
+    for (const auto &indent : {std::optional<unsigned int> {}, std::optional<unsigned int> {0}, std::optional<unsigned int> {3}}) {
+      EXPECT_EQ(streamJsonView(input, indent), display_device::toJson(input, indent, nullptr));
+    }
+  }};
+
+  doTest(display_device::TestEnum::Value2);
+  doTest(display_device::TestStruct {"A", {1}});
+  doTest(display_device::TestThrowingStruct {});
+  doTest(display_device::TestVariant {123.});
+  doTest(display_device::TestVariant {display_device::Rational {1, 2}});
+  doTest(nanoseconds {MIN_NANO_VAL});
+  doTest(nanoseconds {MAX_NANO_VAL});
+  doTest(days {20});
+  doTest(years {20});
+}
+
+TEST_S(JsonView, SameAsToJson, Doubles) {
+  for (const double value : {0.0, -0.0, 1.0, 0.1, 119.9554, 1e15, 1e16, 1e-4, 1e-5, -2.5e-300, std::numeric_limits<double>::max(), std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity()}) {
+    const display_device::TestVariant input {value};
+    EXPECT_EQ(streamJsonView(input, std::nullopt), display_device::toJson(input, std::nullopt, nullptr));
+  }
+}
+
+TEST_S(JsonView, Compact) {
+  EXPECT_EQ(streamJsonView(display_device::TestStruct {}, std::nullopt), R"({"a":"","b":{"c":0}})");
+}
+
+TEST_S(JsonView, WithIndent) {
+  EXPECT_EQ(streamJsonView(display_device::TestStruct {}, 3), "{\n   \"a\": \"\",\n   \"b\": {\n      \"c\": 0\n   }\n}");
+}
+
+TEST_S(JsonView, EscapedString) {
+  const display_device::TestStruct input {"\"\\\b\f\n\r\t\x01/"};
+
+  EXPECT_EQ(streamJsonView(input, std::nullopt), R"({"a":"\"\\\b\f\n\r\t\u0001/","b":{"c":0}})");
+  EXPECT_EQ(streamJsonView(input, std::nullopt), display_device::toJson(input, std::nullopt, nullptr));
+}
+
+TEST_S(JsonView, Error, MissingMappingValue) {
+  EXPECT_EQ(streamJsonView(display_device::TestEnum::Value3, std::nullopt), "TestEnum is missing enum mapping!");
+}
+
+TEST_S(JsonView, Error, StandardExceptions) {
+  using enum display_device::TestThrowingStruct::Error;
+
+  EXPECT_EQ(streamJsonView(display_device::TestThrowingStruct {.m_error = OutOfRange}, std::nullopt), "to_json out_of_range");
+  EXPECT_EQ(streamJsonView(display_device::TestThrowingStruct {.m_error = InvalidArgument}, std::nullopt), "to_json invalid_argument");
+}
+
+TEST_S(JsonView, Logging) {
+  std::string output;
+  display_device::Logger::get().setLogLevel(display_device::Logger::LogLevel::info);
+  display_device::Logger::get().setCustomCallback([&output](auto, const std::string_view value) {
+    output = value;
+  });
+
+  DD_LOG(info) << "Value: " << display_device::jsonView(display_device::TestStruct {"A", {1}}, std::nullopt);
+  EXPECT_EQ(output, R"(Value: {"a":"A","b":{"c":1}})");
+}
+
+TEST_S(Cbor, RoundTrip) {
+  const display_device::TestStruct input {"A", {1}};
+  std::string error_message {};
+
+  const auto data {display_device::toCbor(input, &error_message)};
+  ASSERT_TRUE(data);
+  EXPECT_EQ(*data, nlohmann::json::to_cbor(nlohmann::json::parse(R"({"a":"A","b":{"c":1}})")));
+
+  display_device::TestStruct output {};
+  EXPECT_TRUE(display_device::fromCbor(*data, output, &error_message));
+  EXPECT_EQ(output, input);
+}
+
+TEST_S(ToCbor, Error, StandardExceptions) {
+  using enum display_device::TestThrowingStruct::Error;
+  std::string error_message {};
+
+  EXPECT_EQ(display_device::toCbor(display_device::TestThrowingStruct {.m_error = OutOfRange}, &error_message), std::nullopt);
+  EXPECT_EQ(error_message, "to_json out_of_range");
+  EXPECT_EQ(display_device::toCbor(display_device::TestThrowingStruct {.m_error = InvalidArgument}, nullptr), std::nullopt);
+}
+
+TEST_S(FromCbor, InvalidCbor) {
+  const std::vector<std::uint8_t> data {0xA1, 0x61};
+  const display_device::TestStruct original {"A", {1}};
+  display_device::TestStruct output {original};
+  std::string error_message {};
+
+  EXPECT_FALSE(display_device::fromCbor(data, output, &error_message));
+  EXPECT_EQ(output, original);
+  EXPECT_FALSE(error_message.empty());
+  EXPECT_FALSE(display_device::fromCbor(data, output, nullptr));
+}
+
+TEST_S(FromCbor, Error, StandardExceptions) {
+  const auto data {nlohmann::json::to_cbor(nlohmann::json::parse(R"({"error":"out_of_range"})"))};
+  display_device::TestThrowingStruct value {};
+  std::string error_message {};
+
+  EXPECT_FALSE(display_device::fromCbor(data, value, &error_message));
+  EXPECT_EQ(error_message, "from_json out_of_range");
+}
+
+TEST_S(EncodeState, Json) {
+  std::string error_message {};
+  const auto data {display_device::detail::encodeState(display_device::TestStruct {"A", {1}}, display_device::PersistenceEncoding::Json, error_message)};
+  ASSERT_TRUE(data);
+
+  const std::string expected_string {display_device::toJson(display_device::TestStruct {"A", {1}}, 2, nullptr)};
+  EXPECT_EQ(*data, std::vector<std::uint8_t>(std::begin(expected_string), std::end(expected_string)));
+}
+
+TEST_S(EncodeState, Binary) {
+  std::string error_message {};
+  const auto data {display_device::detail::encodeState(display_device::TestStruct {"A", {1}}, display_device::PersistenceEncoding::Binary, error_message)};
+  ASSERT_TRUE(data);
+
+  std::vector<std::uint8_t> expected_data {0xDD, 'D', 'S', 'T', display_device::detail::BINARY_STATE_VERSION};
+  const auto payload {*display_device::toCbor(display_device::TestStruct {"A", {1}}, nullptr)};
+  expected_data.insert(std::end(expected_data), std::begin(payload), std::end(payload));
+  EXPECT_EQ(*data, expected_data);
+}
+
+TEST_S(EncodeState, Error) {
+  using enum display_device::TestThrowingStruct::Error;
+  std::string error_message {};
+
+  EXPECT_EQ(display_device::detail::encodeState(display_device::TestThrowingStruct {.m_error = OutOfRange}, display_device::PersistenceEncoding::Json, error_message), std::nullopt);
+  EXPECT_EQ(error_message, "to_json out_of_range");
+  EXPECT_EQ(display_device::detail::encodeState(display_device::TestThrowingStruct {.m_error = InvalidArgument}, display_device::PersistenceEncoding::Binary, error_message), std::nullopt);
+  EXPECT_EQ(error_message, "to_json invalid_argument");
+}
+
+TEST_S(DecodeState, DetectsEncoding) {
+  const display_device::TestStruct input {"A", {1}};
+  std::string error_message {};
+
+  for (const auto encoding : {display_device::PersistenceEncoding::Json, display_device::PersistenceEncoding::Binary}) {
+    const auto data {display_device::detail::encodeState(input, encoding, error_message)};
+    ASSERT_TRUE(data);
+
+    display_device::TestStruct output {};
+    EXPECT_TRUE(display_device::detail::decodeState(*data, output, error_message));
+    EXPECT_EQ(output, input);
+  }
+}
+
+TEST_S(DecodeState, Error, MissingVersion) {
+  const std::vector<std::uint8_t> data {0xDD, 'D', 'S', 'T'};
+  display_device::TestStruct output {};
+  std::string error_message {};
+
+  EXPECT_FALSE(display_device::detail::decodeState(data, output, error_message));
+  EXPECT_EQ(error_message, "Binary state is missing the version!");
+}
+
+TEST_S(DecodeState, Error, UnsupportedVersion) {
+  const std::vector<std::uint8_t> data {0xDD, 'D', 'S', 'T', 2, 0xA0};
+  display_device::TestStruct output {};
+  std::string error_message {};
+
+  EXPECT_FALSE(display_device::detail::decodeState(data, output, error_message));
+  EXPECT_EQ(error_message, "Unsupported binary state version 2!");
+}
+
+TEST_S(DecodeState, Error, InvalidJson) {
+  const std::vector<std::uint8_t> data {'{'};
+  display_device::TestStruct output {};
+  std::string error_message {};
+
+  EXPECT_FALSE(display_device::detail::decodeState(data, output, error_message));
+  EXPECT_FALSE(error_message.empty());
+}
+
+TEST_S(LoadState) {
+  const display_device::TestStruct input {"A", {1}};
+  std::string error_message {};
+  const auto data {display_device::detail::encodeState(input, display_device::PersistenceEncoding::Binary, error_message)};
+  ASSERT_TRUE(data);
+
+  testing::StrictMock<display_device::MockSettingsPersistence> persistence;
+  EXPECT_CALL(persistence, load())
+    .Times(2)
+    .WillOnce(testing::Return(*data))
+    .WillOnce(testing::Return(std::vector<std::uint8_t> {}));
+
+  EXPECT_EQ(loadTestState(persistence, true), input);
+  EXPECT_EQ(loadTestState(persistence, true), std::nullopt);
+}
+
+TEST_S(LoadState, Error) {
+  testing::StrictMock<display_device::MockSettingsPersistence> persistence;
+  EXPECT_CALL(persistence, load())
+    .Times(3)
+    .WillOnce(testing::Return(std::nullopt))
+    .WillRepeatedly(testing::Return(std::vector<std::uint8_t> {'{'}));
+
+  EXPECT_THAT([&persistence]() {
+    (void) loadTestState(persistence, true);
+  },
+              ThrowsMessage<std::runtime_error>(testing::Eq("Load failed!")));
+  EXPECT_THAT([&persistence]() {
+    (void) loadTestState(persistence, true);
+  },
+              ThrowsMessage<std::runtime_error>(testing::StartsWith("Parse failed!\n")));
+  EXPECT_EQ(loadTestState(persistence, false), std::nullopt);
+}
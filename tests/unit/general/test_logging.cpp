@@ -1,13 +1,28 @@
 // system includes
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <exception>
 #include <format>
+#include <future>
+#include <gmock/gmock.h>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
 #include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
 
 // local includes
 #include "display_device/logging.h"
 #include "fixtures/fixtures.h"
 
 namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
   class LogWriterDestructorTestException final: public std::exception {
   public:
     [[nodiscard]] const char *what() const noexcept override {
@@ -15,10 +30,56 @@ namespace {
     }
   };
 
+  /**
+   * @brief Value that records whether it has been formatted.
+   */
+  struct FormatProbe {
+    bool *m_formatted;
+  };
+
+  /**
+   * @brief Collects the batches passed to the batch callback.
+   */
+  class BatchCollector {
+  public:
+    display_device::Logger::BatchCallback makeCallback() {
+      return [this](const std::span<const display_device::Logger::BatchRecord> records) {
+        std::lock_guard lock {m_mutex};
+        m_batches.emplace_back(std::begin(records), std::end(records));
+        m_cv.notify_all();
+      };
+    }
+
+    bool waitForBatches(const std::size_t count, const std::chrono::milliseconds timeout = std::chrono::seconds {10}) {
+      std::unique_lock lock {m_mutex};
+      return m_cv.wait_for(lock, timeout, [&]() {
+        return m_batches.size() >= count;
+      });
+    }
+
+    std::vector<std::vector<display_device::Logger::BatchRecord>> getBatches() {
+      std::lock_guard lock {m_mutex};
+      return m_batches;
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<std::vector<display_device::Logger::BatchRecord>> m_batches;
+  };
+
   // Specialized TEST macro(s) for this test file
 #define TEST_S(...) DD_MAKE_TEST(TEST, LoggingTest, __VA_ARGS__)
 }  // namespace
 
+template<>
+struct std::formatter<FormatProbe>: std::formatter<std::string_view> {
+  auto format(const FormatProbe &probe, std::format_context &ctx) const {
+    *probe.m_formatted = true;
+    return std::formatter<std::string_view>::format("probe", ctx);
+  }
+};
+
 TEST_S(LogLevelVerbose) {
   using level = display_device::Logger::LogLevel;
   auto &logger {display_device::Logger::get()};
@@ -240,3 +301,902 @@ TEST_S(LogWriterDestructorDoesNotPropagateCallbackExceptions) {
 
   EXPECT_NO_THROW(DD_LOG(info) << "Hello World!");
 }
+
+TEST_S(AsyncMode, InvalidCapacity) {
+  auto &logger {display_device::Logger::get()};
+
+  EXPECT_THAT([&]() {
+    logger.enableAsyncMode({.m_capacity = 3});
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Capacity specified in MpscRingBuffer must be a power of 2 larger than 1!")));
+}
+
+TEST_S(AsyncMode, CustomCallback) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::mutex mutex;
+  std::vector<std::string> output;
+  std::set<std::thread::id> thread_ids;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&](auto, const std::string_view value) {
+    std::lock_guard lock {mutex};
+    output.emplace_back(value);
+    thread_ids.insert(std::this_thread::get_id());
+  });
+  logger.enableAsyncMode({});
+
+  DD_LOG(info) << "Hello " << 1;
+  DD_LOG(info) << "Hello " << 2;
+  DD_LOG(verbose) << "Hello " << 3;
+  logger.flush();
+
+  std::lock_guard lock {mutex};
+  EXPECT_EQ(output, (std::vector<std::string> {"Hello 1", "Hello 2", "Hello 3"}));
+  EXPECT_EQ(thread_ids.size(), 1);
+  EXPECT_FALSE(thread_ids.contains(std::this_thread::get_id()));
+}
+
+TEST_S(AsyncMode, DefaultLogger) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  logger.setLogLevel(level::verbose);
+  logger.enableAsyncMode({});
+
+  logger.write(level::info, "Hello World!");
+  logger.flush();
+  EXPECT_TRUE(testRegex(coutBuffer().str(), R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] INFO:    Hello World!\n)"));
+}
+
+TEST_S(AsyncMode, DropWhenFull) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::promise<void> entered;
+  std::promise<void> release;
+  auto release_future {release.get_future().share()};
+  std::vector<std::string> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&, first = true](auto, const std::string_view value) mutable {
+    if (std::exchange(first, false)) {
+      entered.set_value();
+      release_future.wait();
+    }
+    output.emplace_back(value);
+  });
+  logger.enableAsyncMode({.m_capacity = 2, .m_full_policy = display_device::Logger::AsyncFullPolicy::Drop});
+
+  // The first record is being "written", while the other two fill up the queue
+  logger.write(level::info, "1");
+  entered.get_future().wait();
+  logger.write(level::info, "2");
+  logger.write(level::info, "3");
+  logger.write(level::info, "4");
+  logger.write(level::info, "5");
+  EXPECT_EQ(logger.getDroppedCount(), 2);
+
+  release.set_value();
+  logger.flush();
+  EXPECT_EQ(output, (std::vector<std::string> {"1", "2", "3"}));
+}
+
+TEST_S(AsyncMode, BlockWhenFull) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::promise<void> entered;
+  std::promise<void> release;
+  auto release_future {release.get_future().share()};
+  std::vector<std::string> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&, first = true](auto, const std::string_view value) mutable {
+    if (std::exchange(first, false)) {
+      entered.set_value();
+      release_future.wait();
+    }
+    output.emplace_back(value);
+  });
+  logger.enableAsyncMode({.m_capacity = 2, .m_full_policy = display_device::Logger::AsyncFullPolicy::Block});
+
+  logger.write(level::info, "1");
+  entered.get_future().wait();
+  auto writer {std::async(std::launch::async, [&]() {
+    for (const auto *value : {"2", "3", "4", "5"}) {
+      logger.write(level::info, value);
+    }
+  })};
+  EXPECT_EQ(writer.wait_for(std::chrono::milliseconds {50}), std::future_status::timeout);
+
+  release.set_value();
+  writer.get();
+  logger.flush();
+  EXPECT_EQ(output, (std::vector<std::string> {"1", "2", "3", "4", "5"}));
+  EXPECT_EQ(logger.getDroppedCount(), 0);
+}
+
+TEST_S(AsyncMode, FatalIsFlushed) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::atomic_int written {0};
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&](auto, auto) {
+    written++;
+  });
+  logger.enableAsyncMode({});
+
+  logger.write(level::info, "Hello World!");
+  logger.write(level::fatal, "Hello World!");
+  EXPECT_EQ(written, 2);
+}
+
+TEST_S(AsyncMode, FlushedOnDisable) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::atomic_int written {0};
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&](auto, auto) {
+    std::this_thread::sleep_for(std::chrono::milliseconds {1});
+    written++;
+  });
+  logger.enableAsyncMode({});
+
+  for (int i {0}; i < 10; ++i) {
+    logger.write(level::info, "Hello World!");
+  }
+  logger.disableAsyncMode();
+  EXPECT_EQ(written, 10);
+
+  // Back to the synchronous mode
+  logger.write(level::info, "Hello World!");
+  EXPECT_EQ(written, 11);
+}
+
+TEST_S(AsyncMode, LoggingFromCallback) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&](auto, const std::string_view value) {
+    output.emplace_back(value);
+    if (value == "outer") {
+      // Would deadlock if it was queued, as fatal waits for the queue to be drained
+      DD_LOG(fatal) << "inner";
+    }
+  });
+  logger.enableAsyncMode({});
+
+  logger.write(level::info, "outer");
+  logger.flush();
+  EXPECT_EQ(output, (std::vector<std::string> {"outer", "inner"}));
+}
+
+TEST_S(AsyncMode, ToggledWhileLogging) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::atomic_int written {0};
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&](auto, auto) {
+    written++;
+  });
+
+  std::atomic_bool keep_logging {true};
+  std::vector<std::thread> writers;
+  std::atomic_int logged {0};
+  for (int i {0}; i < 4; ++i) {
+    writers.emplace_back([&]() {
+      while (keep_logging) {
+        logger.write(level::info, "Hello World!");
+        logged++;
+      }
+    });
+  }
+
+  for (int i {0}; i < 50; ++i) {
+    logger.enableAsyncMode({.m_capacity = 16, .m_full_policy = display_device::Logger::AsyncFullPolicy::Block});
+    logger.disableAsyncMode();
+  }
+
+  keep_logging = false;
+  for (auto &writer : writers) {
+    writer.join();
+  }
+  logger.flush();
+  EXPECT_EQ(written, logged);
+}
+
+TEST_S(FormatMacro) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::string output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output = value;
+  });
+
+  DD_LOGF(info, "Hello {}! {}", "World", 123);
+  EXPECT_EQ(output, "Hello World! 123");
+
+  DD_LOGF(info, "No arguments");
+  EXPECT_EQ(output, "No arguments");
+}
+
+TEST_S(FormatMacro, DisablesArgumentEvaluation) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  bool output_logged {false};
+  logger.setCustomCallback([&output_logged](auto, auto) {
+    output_logged = true;
+  });
+
+  bool some_function_invoked {false};
+  const auto some_function {[&some_function_invoked]() {
+    some_function_invoked = true;
+    return "some string";
+  }};
+
+  logger.setLogLevel(level::error);
+  DD_LOGF(info, "{}", some_function());
+  EXPECT_EQ(output_logged, false);
+  EXPECT_EQ(some_function_invoked, false);
+
+  logger.setLogLevel(level::info);
+  DD_LOGF(info, "{}", some_function());
+  EXPECT_EQ(output_logged, true);
+  EXPECT_EQ(some_function_invoked, true);
+}
+
+TEST_S(WriteFormatted, SkipsFormatting) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  bool output_logged {false};
+  logger.setCustomCallback([&output_logged](auto, auto) {
+    output_logged = true;
+  });
+
+  bool formatter_invoked {false};
+  const FormatProbe probe {&formatter_invoked};
+
+  logger.setLogLevel(level::error);
+  logger.writeFormatted(level::info, "{}", probe);
+  EXPECT_EQ(output_logged, false);
+  EXPECT_EQ(formatter_invoked, false);
+
+  logger.setLogLevel(level::info);
+  logger.writeFormatted(level::info, "{}", probe);
+  EXPECT_EQ(output_logged, true);
+  EXPECT_EQ(formatter_invoked, true);
+}
+
+TEST_S(FormatMacro, BufferIsReused) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<const char *> buffers;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&buffers](auto, const std::string_view value) {
+    buffers.push_back(value.data());
+  });
+
+  DD_LOGF(info, "{}", std::string(100, 'a'));
+  DD_LOGF(info, "{}", std::string(10, 'b'));
+  ASSERT_EQ(buffers.size(), 2);
+  EXPECT_EQ(buffers[0], buffers[1]);
+}
+
+TEST_S(FormatMacro, NestedCall) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    if (value == "outer") {
+      DD_LOGF(info, "inner");
+    }
+    // The outer view must still be intact after the nested call
+    output.emplace_back(value);
+  });
+
+  DD_LOGF(info, "{}", "outer");
+  EXPECT_EQ(output, (std::vector<std::string> {"inner", "outer"}));
+}
+
+TEST_S(LiveReconfiguration, ConcurrentWriters) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::atomic_int first_count {0};
+  std::atomic_int second_count {0};
+  std::atomic_bool keep_writing {true};
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&](auto, auto) {
+    first_count++;
+  });
+
+  std::vector<std::thread> writers;
+  for (int i {0}; i < 4; ++i) {
+    writers.emplace_back([&]() {
+      while (keep_writing) {
+        DD_LOG(info) << "Hello World!";
+      }
+    });
+  }
+
+  for (int i {0}; i < 100; ++i) {
+    logger.setLogLevel(i % 2 == 0 ? level::info : level::error);
+    logger.setCustomCallback([&](auto, auto) {
+      second_count++;
+    });
+    std::this_thread::yield();
+    logger.setCustomCallback([&](auto, auto) {
+      first_count++;
+    });
+  }
+
+  // The latest changes are picked up by the running writers
+  logger.setLogLevel(level::info);
+  logger.setCustomCallback([&](auto, auto) {
+    second_count++;
+  });
+  const auto count_before {second_count.load()};
+  while (second_count == count_before) {
+    std::this_thread::yield();
+  }
+
+  keep_writing = false;
+  for (auto &writer : writers) {
+    writer.join();
+  }
+  EXPECT_GT(second_count, count_before);
+}
+
+TEST_S(LiveReconfiguration, OldCallbackOutlivesInvocation) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::promise<void> entered;
+  std::promise<void> release;
+  auto release_future {release.get_future().share()};
+  const auto sentinel {std::make_shared<int>(0)};
+  const std::weak_ptr<int> weak_sentinel {sentinel};
+
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&, sentinel](auto, auto) {
+    entered.set_value();
+    release_future.wait();
+  });
+
+  auto writer {std::async(std::launch::async, [&]() {
+    logger.write(level::info, "Hello World!");
+  })};
+  entered.get_future().wait();
+
+  // The replacement has to wait for the running invocation to finish
+  auto replacer {std::async(std::launch::async, [&]() {
+    logger.setCustomCallback(nullptr);
+  })};
+  EXPECT_EQ(replacer.wait_for(std::chrono::milliseconds {50}), std::future_status::timeout);
+  EXPECT_FALSE(weak_sentinel.expired());
+
+  release.set_value();
+  writer.get();
+  replacer.get();
+  EXPECT_EQ(weak_sentinel.use_count(), 1);  // Only the local copy is left
+}
+
+TEST_S(TimestampFormat) {
+  using level = display_device::Logger::LogLevel;
+  using format = display_device::Logger::TimestampFormat;
+  auto &logger {display_device::Logger::get()};
+
+  const auto write_and_get_cout {[this, &logger](format format) {
+    coutBuffer().str(std::string {});  // reset the buffer
+    logger.setTimestampFormat(format);
+    logger.write(level::info, "Hello World!");
+    return coutBuffer().str();
+  }};
+
+  logger.setLogLevel(level::verbose);
+  // Switching back and forth must not reuse the prefix of the other format
+  for (int i {0}; i < 2; ++i) {
+    // clang-format off
+    EXPECT_TRUE(testRegex(write_and_get_cout(format::LocalTime),  R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] INFO:    Hello World!\n)"));
+    EXPECT_TRUE(testRegex(write_and_get_cout(format::UtcIso8601), R"(\[\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}.\d{3}Z\] INFO:    Hello World!\n)"));
+    EXPECT_TRUE(testRegex(write_and_get_cout(format::Monotonic),  R"(\[\d+.\d{3}\] INFO:    Hello World!\n)"));
+    // clang-format on
+  }
+}
+
+TEST_S(TimestampFormat, UtcMatchesSystemClock) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  logger.setLogLevel(level::verbose);
+  logger.setTimestampFormat(display_device::Logger::TimestampFormat::UtcIso8601);
+
+  // The date and time (without the seconds) could only differ if the minute changes in between
+  for (int i {0}; i < 2; ++i) {
+    const auto now {std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now())};
+    const auto expected_prefix {std::format("[{:%Y-%m-%dT%H:%M}", now)};
+
+    coutBuffer().str(std::string {});  // reset the buffer
+    logger.write(level::info, "Hello World!");
+    if (coutBuffer().str().starts_with(expected_prefix)) {
+      break;
+    }
+    EXPECT_EQ(i, 0) << coutBuffer().str();
+  }
+}
+
+TEST_S(Category, LogLevel) {
+  using level = display_device::Logger::LogLevel;
+  using category = display_device::Logger::LogCategory;
+  auto &logger {display_device::Logger::get()};
+
+  logger.setLogLevel(level::info);
+  logger.setLogLevel(category::scheduler, level::debug);
+  logger.setLogLevel(category::persistence, level::error);
+
+  EXPECT_TRUE(logger.isLogLevelEnabled(category::scheduler, level::debug));
+  EXPECT_FALSE(logger.isLogLevelEnabled(category::scheduler, level::verbose));
+  EXPECT_FALSE(logger.isLogLevelEnabled(category::persistence, level::warning));
+  EXPECT_TRUE(logger.isLogLevelEnabled(category::persistence, level::error));
+  EXPECT_FALSE(logger.isLogLevelEnabled(category::modes, level::debug));
+  EXPECT_TRUE(logger.isLogLevelEnabled(category::modes, level::info));
+  EXPECT_FALSE(logger.isLogLevelEnabled(level::debug));
+
+  // Following the global level again
+  logger.resetLogLevel(category::scheduler);
+  EXPECT_FALSE(logger.isLogLevelEnabled(category::scheduler, level::debug));
+  logger.setLogLevel(level::verbose);
+  EXPECT_TRUE(logger.isLogLevelEnabled(category::scheduler, level::debug));
+  EXPECT_FALSE(logger.isLogLevelEnabled(category::persistence, level::warning));
+}
+
+TEST_S(Category, Macros) {
+  using level = display_device::Logger::LogLevel;
+  using category = display_device::Logger::LogCategory;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output.emplace_back(value);
+  });
+  logger.setLogLevel(level::info);
+  logger.setLogLevel(category::scheduler, level::debug);
+
+  DD_LOG(debug) << "general";
+  DD_LOG_CAT(topology, debug) << "topology";
+  DD_LOG_CAT(scheduler, debug) << "scheduler";
+  DD_LOGF_CAT(scheduler, debug, "{}", "formatted");
+  DD_LOGF_CAT(hdr, debug, "{}", "hdr");
+  EXPECT_EQ(output, (std::vector<std::string> {"scheduler", "formatted"}));
+}
+
+TEST_S(StructuredRecord, RecordCallback) {
+  using level = display_device::Logger::LogLevel;
+  using category = display_device::Logger::LogCategory;
+  using value = display_device::Logger::FieldValue;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::tuple<category, level, std::string, std::vector<std::pair<std::string, value>>>> records;
+  logger.setLogLevel(level::verbose);
+  logger.setRecordCallback([&records](const display_device::Logger::Record &record) {
+    std::vector<std::pair<std::string, value>> fields;
+    for (const auto &field : record.m_fields) {
+      fields.emplace_back(field.m_key, field.m_value);
+    }
+    records.emplace_back(record.m_category, record.m_level, std::string {record.m_message}, std::move(fields));
+  });
+
+  const std::string device_id {"DeviceId1"};
+  DD_LOG_FIELDS(scheduler, info, "Retrying", {"attempt", 2}, {"delay_ms", 100U}, {"ratio", 0.5}, {"device_id", device_id}, {"dry_run", false});
+  DD_LOG_FIELDS(hdr, warning, "No fields");
+  DD_LOG(error) << "Plain text";
+
+  ASSERT_EQ(records.size(), 3);
+  EXPECT_EQ(records[0], std::make_tuple(category::scheduler, level::info, std::string {"Retrying"}, std::vector<std::pair<std::string, value>> {{"attempt", std::int64_t {2}}, {"delay_ms", std::uint64_t {100}}, {"ratio", 0.5}, {"device_id", std::string {"DeviceId1"}}, {"dry_run", false}}));
+  EXPECT_EQ(records[1], std::make_tuple(category::hdr, level::warning, std::string {"No fields"}, std::vector<std::pair<std::string, value>> {}));
+  EXPECT_EQ(records[2], std::make_tuple(category::general, level::error, std::string {"Plain text"}, std::vector<std::pair<std::string, value>> {}));
+}
+
+TEST_S(StructuredRecord, RenderedForCustomCallback) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::string output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output = value;
+  });
+
+  DD_LOG_FIELDS(scheduler, info, "Retrying", {"attempt", 2}, {"device_id", "DeviceId1"}, {"dry_run", true});
+  EXPECT_EQ(output, R"(Retrying attempt=2 device_id="DeviceId1" dry_run=true)");
+}
+
+TEST_S(StructuredRecord, RenderedForDefaultLogger) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  logger.setLogLevel(level::verbose);
+  DD_LOG_FIELDS(scheduler, info, "Retrying", {"attempt", 2});
+  EXPECT_TRUE(testRegex(coutBuffer().str(), R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] INFO:    Retrying attempt=2\n)"));
+}
+
+TEST_S(StructuredRecord, AsyncMode) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::string output;
+  logger.setLogLevel(level::verbose);
+  logger.setRecordCallback([&output](const display_device::Logger::Record &record) {
+    output = std::format("{} {}", record.m_message, record.m_fields.size());
+  });
+  logger.enableAsyncMode({});
+
+  DD_LOG_FIELDS(scheduler, info, "Retrying", {"attempt", 2}, {"device_id", "DeviceId1"});
+  logger.flush();
+  EXPECT_EQ(output, "Retrying 2");
+}
+
+TEST_S(StructuredRecord, RespectsCategoryLevel) {
+  using level = display_device::Logger::LogLevel;
+  using category = display_device::Logger::LogCategory;
+  auto &logger {display_device::Logger::get()};
+
+  int records {0};
+  logger.setLogLevel(level::verbose);
+  logger.setLogLevel(category::scheduler, level::error);
+  logger.setRecordCallback([&records](auto) {
+    records++;
+  });
+
+  DD_LOG_FIELDS(scheduler, info, "Retrying", {"attempt", 2});
+  DD_LOG_FIELDS(persistence, info, "Saving", {"size", 2});
+  EXPECT_EQ(records, 1);
+}
+
+TEST_S(RateLimit, EveryN) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output.emplace_back(value);
+  });
+
+  logger.setLogLevel(level::verbose);
+  for (int i {0}; i < 7; ++i) {
+    DD_LOG_EVERY_N(info, 3) << "a" << i;
+    DD_LOG_CAT_EVERY_N(scheduler, info, 1) << "b" << i;
+  }
+  EXPECT_EQ(output, (std::vector<std::string> {"a0", "b0", "b1", "b2", "a3", "b3", "b4", "b5", "a6", "b6"}));
+
+  // Disabled occurrences are not counted
+  output.clear();
+  logger.setLogLevel(level::error);
+  for (int i {0}; i < 2; ++i) {
+    DD_LOG_EVERY_N(info, 2) << "c" << i;
+  }
+  logger.setLogLevel(level::info);
+  for (int i {2}; i < 4; ++i) {
+    DD_LOG_EVERY_N(info, 2) << "c" << i;
+  }
+  EXPECT_EQ(output, (std::vector<std::string> {"c2"}));
+}
+
+TEST_S(RateLimit, OncePer) {
+  using level = display_device::Logger::LogLevel;
+  using namespace std::chrono_literals;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output.emplace_back(value);
+  });
+
+  const auto log_once_per {[]() {
+    DD_LOG_ONCE_PER(info, 100ms) << "a";
+    DD_LOG_CAT_ONCE_PER(scheduler, info, 1h) << "b";
+  }};
+
+  log_once_per();
+  log_once_per();
+  EXPECT_EQ(output, (std::vector<std::string> {"a", "b"}));
+
+  std::this_thread::sleep_for(150ms);
+  log_once_per();
+  EXPECT_EQ(output, (std::vector<std::string> {"a", "b", "a"}));
+}
+
+TEST_S(RateLimit, RepeatLimiter) {
+  using level = display_device::Logger::LogLevel;
+  using namespace std::chrono_literals;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setLogLevel(level::info);
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output.emplace_back(value);
+  });
+
+  {
+    display_device::LogRepeatLimiter limiter {100ms};
+    const auto log_limited {[&limiter](const int value) {
+      DD_LOG_LIMITED(info, limiter) << "Trying...";
+      DD_LOG_CAT_LIMITED(scheduler, error, limiter) << "Failed:\n"
+                                                    << value;
+      DD_LOG_LIMITED(verbose, limiter) << "Disabled";
+    }};
+
+    // Interleaved records do not prevent the suppression, different messages are written
+    log_limited(1);
+    log_limited(1);
+    log_limited(2);
+    log_limited(1);
+    EXPECT_EQ(output, (std::vector<std::string> {"Trying...", "Failed:\n1", "Failed:\n2"}));
+
+    // Suppressed repeats are reported once the interval has elapsed
+    output.clear();
+    std::this_thread::sleep_for(150ms);
+    log_limited(2);
+    EXPECT_EQ(output, (std::vector<std::string> {"Suppressed 2 repeat(s) of the message: Failed:", "Suppressed 3 repeat(s) of the message: Trying...", "Trying...", "Failed:\n2"}));
+
+    output.clear();
+    log_limited(2);
+    EXPECT_TRUE(output.empty());
+  }
+
+  // Pending repeats are reported on destruction
+  EXPECT_EQ(output, (std::vector<std::string> {"Suppressed 1 repeat(s) of the message: Failed:", "Suppressed 1 repeat(s) of the message: Trying..."}));
+}
+
+TEST_S(Deduplication) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output.emplace_back(value);
+  });
+  logger.enableDeduplication();
+
+  for (int i {0}; i < 3; ++i) {
+    DD_LOG(error) << "Failed!";
+  }
+  DD_LOG(warning) << "Failed!";  // Different level
+  DD_LOG(warning) << "Failed!";
+  DD_LOG(info) << "Done.";
+  DD_LOG(info) << "Done.";
+  EXPECT_EQ(output, (std::vector<std::string> {"Failed!", "Previous message repeated 2 time(s).", "Failed!", "Previous message repeated 1 time(s).", "Done."}));
+
+  // Pending summary is written out on flush
+  logger.flush();
+  EXPECT_EQ(output.back(), "Previous message repeated 1 time(s).");
+  EXPECT_EQ(output.size(), 6);
+}
+
+TEST_S(Deduplication, Fields) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output.emplace_back(value);
+  });
+  logger.enableDeduplication();
+
+  DD_LOG_FIELDS(scheduler, error, "Failed!", {"attempt", 1});
+  DD_LOG_FIELDS(scheduler, error, "Failed!", {"attempt", 2});
+  DD_LOG_FIELDS(scheduler, error, "Failed!", {"attempt", 2});
+  DD_LOG_FIELDS(persistence, error, "Failed!", {"attempt", 2});
+  EXPECT_EQ(output, (std::vector<std::string> {"Failed! attempt=1", "Failed! attempt=2", "Previous message repeated 1 time(s).", "Failed! attempt=2"}));
+}
+
+TEST_S(Deduplication, SummaryInterval) {
+  using level = display_device::Logger::LogLevel;
+  using namespace std::chrono_literals;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output.emplace_back(value);
+  });
+  logger.enableDeduplication(50ms);
+
+  DD_LOG(error) << "Failed!";
+  DD_LOG(error) << "Failed!";
+  std::this_thread::sleep_for(60ms);
+  DD_LOG(error) << "Failed!";
+  DD_LOG(error) << "Failed!";
+  EXPECT_EQ(output, (std::vector<std::string> {"Failed!", "Previous message repeated 2 time(s)."}));
+
+  // Disabling writes out the rest
+  logger.disableDeduplication();
+  DD_LOG(error) << "Failed!";
+  EXPECT_EQ(output, (std::vector<std::string> {"Failed!", "Previous message repeated 2 time(s).", "Previous message repeated 1 time(s).", "Failed!"}));
+}
+
+TEST_S(BatchCallback, InvalidOptions) {
+  auto &logger {display_device::Logger::get()};
+
+  EXPECT_THAT([&]() {
+    logger.setBatchCallback([](auto) {}, {.m_max_records = 0});
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Max records specified in BatchOptions must be larger than 0!")));
+  EXPECT_THAT([&]() {
+    logger.setBatchCallback([](auto) {}, {.m_flush_interval = std::chrono::milliseconds {0}});
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Flush interval specified in BatchOptions must be positive!")));
+  EXPECT_NO_THROW(logger.setBatchCallback(nullptr, {.m_max_records = 0}));
+}
+
+TEST_S(BatchCallback, RecordThreshold) {
+  using level = display_device::Logger::LogLevel;
+  using category = display_device::Logger::LogCategory;
+  auto &logger {display_device::Logger::get()};
+
+  BatchCollector collector;
+  logger.setLogLevel(level::verbose);
+  logger.setBatchCallback(collector.makeCallback(), {.m_max_records = 3, .m_flush_interval = std::chrono::hours {1}});
+
+  DD_LOG(info) << "Hello " << 1;
+  DD_LOG_CAT(scheduler, warning) << "Hello " << 2;
+  DD_LOG_FIELDS(hdr, verbose, "Hello 3", {"attempt", 2});
+  ASSERT_TRUE(collector.waitForBatches(1));
+
+  const auto batches {collector.getBatches()};
+  ASSERT_EQ(batches.size(), 1);
+  ASSERT_EQ(batches[0].size(), 3);
+  EXPECT_EQ(batches[0][0].m_category, category::general);
+  EXPECT_EQ(batches[0][0].m_level, level::info);
+  EXPECT_EQ(batches[0][0].m_text, "Hello 1");
+  EXPECT_EQ(batches[0][1].m_category, category::scheduler);
+  EXPECT_EQ(batches[0][1].m_level, level::warning);
+  EXPECT_EQ(batches[0][1].m_text, "Hello 2");
+  EXPECT_EQ(batches[0][2].m_category, category::hdr);
+  EXPECT_EQ(batches[0][2].m_level, level::verbose);
+  EXPECT_EQ(batches[0][2].m_text, "Hello 3 attempt=2");
+  EXPECT_LE(batches[0][0].m_timestamp, batches[0][1].m_timestamp);
+  EXPECT_LE(batches[0][1].m_timestamp, batches[0][2].m_timestamp);
+  EXPECT_TRUE(coutBuffer().str().empty());
+}
+
+TEST_S(BatchCallback, ByteThreshold) {
+  auto &logger {display_device::Logger::get()};
+
+  BatchCollector collector;
+  logger.setBatchCallback(collector.makeCallback(), {.m_max_records = 1000, .m_max_bytes = 10, .m_flush_interval = std::chrono::hours {1}});
+
+  DD_LOG(info) << "Hello";
+  DD_LOG(info) << "World!";
+  ASSERT_TRUE(collector.waitForBatches(1));
+  EXPECT_EQ(collector.getBatches()[0].size(), 2);
+}
+
+TEST_S(BatchCallback, FlushInterval) {
+  auto &logger {display_device::Logger::get()};
+
+  BatchCollector collector;
+  logger.setBatchCallback(collector.makeCallback(), {.m_max_records = 1000, .m_flush_interval = std::chrono::milliseconds {10}});
+
+  DD_LOG(info) << "Hello World!";
+  ASSERT_TRUE(collector.waitForBatches(1));
+  EXPECT_EQ(collector.getBatches()[0].size(), 1);
+}
+
+TEST_S(BatchCallback, FlushIntervalWhenIdle) {
+  auto &logger {display_device::Logger::get()};
+
+  BatchCollector collector;
+  logger.setBatchCallback(collector.makeCallback(), {.m_max_records = 1000, .m_flush_interval = std::chrono::milliseconds {10}});
+
+  // Let the background thread go idle before anything is logged
+  std::this_thread::sleep_for(std::chrono::milliseconds {50});
+
+  DD_LOG(info) << "Hello World!";
+  ASSERT_TRUE(collector.waitForBatches(1, std::chrono::milliseconds {500}));
+  EXPECT_EQ(collector.getBatches()[0].size(), 1);
+}
+
+TEST_S(BatchCallback, Flush) {
+  auto &logger {display_device::Logger::get()};
+
+  BatchCollector collector;
+  logger.setBatchCallback(collector.makeCallback(), {.m_max_records = 1000, .m_flush_interval = std::chrono::hours {1}});
+
+  DD_LOG(info) << "Hello";
+  DD_LOG(info) << "World!";
+  logger.flush();
+
+  const auto batches {collector.getBatches()};
+  ASSERT_EQ(batches.size(), 1);
+  EXPECT_EQ(batches[0].size(), 2);
+
+  // Nothing is pending anymore
+  logger.flush();
+  EXPECT_EQ(collector.getBatches().size(), 1);
+}
+
+TEST_S(BatchCallback, FatalIsFlushed) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  BatchCollector collector;
+  logger.setBatchCallback(collector.makeCallback(), {.m_max_records = 1000, .m_flush_interval = std::chrono::hours {1}});
+
+  logger.write(level::info, "Hello World!");
+  logger.write(level::fatal, "Hello World!");
+  ASSERT_EQ(collector.getBatches().size(), 1);
+  EXPECT_EQ(collector.getBatches()[0].size(), 2);
+}
+
+TEST_S(BatchCallback, PendingRecordsDeliveredOnReplace) {
+  auto &logger {display_device::Logger::get()};
+
+  BatchCollector old_collector;
+  BatchCollector new_collector;
+  logger.setBatchCallback(old_collector.makeCallback(), {.m_max_records = 1000, .m_flush_interval = std::chrono::hours {1}});
+
+  DD_LOG(info) << "Hello";
+  logger.setBatchCallback(new_collector.makeCallback(), {.m_max_records = 1000, .m_flush_interval = std::chrono::hours {1}});
+  DD_LOG(info) << "World!";
+  logger.setBatchCallback(nullptr, {});
+
+  ASSERT_EQ(old_collector.getBatches().size(), 1);
+  EXPECT_EQ(old_collector.getBatches()[0][0].m_text, "Hello");
+  ASSERT_EQ(new_collector.getBatches().size(), 1);
+  EXPECT_EQ(new_collector.getBatches()[0][0].m_text, "World!");
+}
+
+TEST_S(BatchCallback, AsyncMode) {
+  auto &logger {display_device::Logger::get()};
+
+  BatchCollector collector;
+  logger.setBatchCallback(collector.makeCallback(), {.m_max_records = 1000, .m_flush_interval = std::chrono::hours {1}});
+  logger.enableAsyncMode({});
+
+  for (int i {0}; i < 10; ++i) {
+    DD_LOG(info) << "Hello " << i;
+  }
+  logger.flush();
+
+  const auto batches {collector.getBatches()};
+  ASSERT_EQ(batches.size(), 1);
+  ASSERT_EQ(batches[0].size(), 10);
+  EXPECT_EQ(batches[0][9].m_text, "Hello 9");
+}
+
+TEST_S(BatchCallback, LoggingFromCallback) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setBatchCallback([&](const std::span<const display_device::Logger::BatchRecord> records) {
+    for (const auto &record : records) {
+      output.emplace_back(record.m_text);
+      if (record.m_text == "outer") {
+        // Would deadlock if it was delivered right away
+        DD_LOG(fatal) << "inner";
+      }
+    }
+  },
+                          {.m_max_records = 1000, .m_flush_interval = std::chrono::hours {1}});
+
+  logger.write(level::info, "outer");
+  logger.flush();
+  logger.flush();
+  EXPECT_EQ(output, (std::vector<std::string> {"outer", "inner"}));
+}
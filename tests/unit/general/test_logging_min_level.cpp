@@ -0,0 +1,65 @@
+// Compile the statements in this file with a higher floor than the rest of the library
+#undef DD_LOG_MIN_LEVEL
+#define DD_LOG_MIN_LEVEL 2  // NOLINT(cppcoreguidelines-macro-usage): Overrides the floor for this file only.
+
+// system includes
+#include <string>
+#include <string_view>
+#include <vector>
+
+// local includes
+#include "display_device/logging.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, LoggingMinLevelTest, __VA_ARGS__)
+}  // namespace
+
+TEST_S(StatementsBelowFloorAreCompiledOut) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output.emplace_back(value);
+  });
+
+  bool some_function_invoked {false};
+  const auto some_function {[&some_function_invoked]() {
+    some_function_invoked = true;
+    return "some string";
+  }};
+
+  DD_LOG(verbose) << some_function();
+  DD_LOG(debug) << some_function();
+  DD_LOGF(verbose, "{}", some_function());
+  DD_LOGF(debug, "{}", some_function());
+  EXPECT_TRUE(output.empty());
+  EXPECT_FALSE(some_function_invoked);
+
+  DD_LOG(info) << "info";
+  DD_LOGF(warning, "{}", "warning");
+  EXPECT_EQ(output, (std::vector<std::string> {"info", "warning"}));
+
+  // The runtime level is still respected above the floor
+  logger.setLogLevel(level::error);
+  DD_LOG(info) << "info";
+  DD_LOGF(warning, "{}", "warning");
+  EXPECT_EQ(output.size(), 2);
+}
+
+TEST_S(WriteIsNotAffected) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  bool callback_invoked {false};
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&callback_invoked](auto, auto) {
+    callback_invoked = true;
+  });
+
+  logger.write(level::verbose, "Hello World!");
+  EXPECT_TRUE(callback_invoked);
+}
@@ -0,0 +1,91 @@
+// system includes
+#include <gmock/gmock.h>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// local includes
+#include "display_device/mpsc_ring_buffer.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, MpscRingBufferTest, __VA_ARGS__)
+}  // namespace
+
+TEST_S(InvalidCapacity) {
+  for (const std::size_t capacity : {0, 1, 3, 1000}) {
+    EXPECT_THAT([&]() {
+      display_device::MpscRingBuffer<int> buffer {capacity};
+    },
+                ThrowsMessage<std::invalid_argument>(HasSubstr("Capacity specified in MpscRingBuffer must be a power of 2 larger than 1!")));
+  }
+}
+
+TEST_S(PushAndPop) {
+  display_device::MpscRingBuffer<int> buffer {4};
+  EXPECT_EQ(buffer.getCapacity(), 4);
+  EXPECT_EQ(buffer.tryPop(), std::nullopt);
+
+  // Wrap around the buffer a couple of times
+  for (int round {0}; round < 3; ++round) {
+    for (int i {0}; i < 4; ++i) {
+      EXPECT_TRUE(buffer.tryPush(round * 10 + i));
+    }
+    EXPECT_FALSE(buffer.tryPush(-1));
+
+    for (int i {0}; i < 4; ++i) {
+      EXPECT_EQ(buffer.tryPop(), round * 10 + i);
+    }
+    EXPECT_EQ(buffer.tryPop(), std::nullopt);
+  }
+}
+
+TEST_S(FailedPushKeepsValue) {
+  display_device::MpscRingBuffer<std::string> buffer {2};
+  EXPECT_TRUE(buffer.tryPush("a"));
+  EXPECT_TRUE(buffer.tryPush("b"));
+
+  std::string value {"c"};
+  EXPECT_FALSE(buffer.tryPush(std::move(value)));
+  EXPECT_EQ(value, "c");  // NOLINT(bugprone-use-after-move): value is untouched on failure.
+}
+
+TEST_S(ConcurrentProducers) {
+  constexpr int producer_count {4};
+  constexpr int values_per_producer {10000};
+  display_device::MpscRingBuffer<int> buffer {64};
+
+  std::vector<std::thread> producers;
+  for (int producer {0}; producer < producer_count; ++producer) {
+    producers.emplace_back([&buffer, producer]() {
+      for (int i {0}; i < values_per_producer; ++i) {
+        while (!buffer.tryPush(producer * values_per_producer + i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::set<int> values;
+  std::vector<int> last_per_producer(producer_count, -1);
+  while (values.size() < producer_count * values_per_producer) {
+    if (const auto value {buffer.tryPop()}; value) {
+      // Values from the same producer keep their order
+      EXPECT_GT(*value % values_per_producer, last_per_producer[*value / values_per_producer]);
+      last_per_producer[*value / values_per_producer] = *value % values_per_producer;
+      values.insert(*value);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  EXPECT_EQ(buffer.tryPop(), std::nullopt);
+}
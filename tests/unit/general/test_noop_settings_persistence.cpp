@@ -22,6 +22,12 @@ TEST_F_S(Load) {
   EXPECT_EQ(m_impl.load(), std::vector<std::uint8_t> {});
 }
 
+TEST_F_S(LoadView) {
+  const auto view {m_impl.loadView()};
+  ASSERT_TRUE(view);
+  EXPECT_TRUE(view->empty());
+}
+
 TEST_F_S(Clear) {
   EXPECT_TRUE(m_impl.clear());
 }
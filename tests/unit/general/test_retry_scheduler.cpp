@@ -1,11 +1,19 @@
 // system includes
+#include <atomic>
+#include <coroutine>
 #include <exception>
+#include <future>
 #include <gmock/gmock.h>
+#include <memory>
+#include <set>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 
 // local includes
+#include "display_device/manual_scheduler_clock.h"
 #include "display_device/retry_scheduler.h"
 #include "fixtures/fixtures.h"
 
@@ -26,6 +34,29 @@ namespace {
     void constMethod() const { /* noop */ }
   };
 
+  // A minimal eagerly started coroutine type for the tests
+  struct TestTask {
+    struct promise_type {
+      TestTask get_return_object() {
+        return {};
+      }
+
+      std::suspend_never initial_suspend() noexcept {
+        return {};
+      }
+
+      std::suspend_never final_suspend() noexcept {
+        return {};
+      }
+
+      void return_void() {}
+
+      void unhandled_exception() {
+        std::terminate();
+      }
+    };
+  };
+
   class SchedulerStopTokenTestException final: public std::runtime_error {
   public:
     SchedulerStopTokenTestException():
@@ -324,6 +355,499 @@ TEST_F_S(Schedule, ExceptionThrown, DuringScheduledCall) {
   m_impl.stop();
 }
 
+TEST_F_S(Schedule, Backoff, DurationsAlsoProvided) {
+  EXPECT_THAT([&]() {
+    m_impl.schedule([](auto, auto &) {
+    },
+                    {.m_sleep_durations = {1ms}, .m_backoff = display_device::ConstantBackoff {1ms}});
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Sleep durations and backoff policy cannot be both specified in RetryScheduler::schedule!")));
+}
+
+TEST_F_S(Schedule, Backoff, InvalidPolicy) {
+  EXPECT_THAT([&]() {
+    m_impl.schedule([](auto, auto &) {
+    },
+                    {.m_backoff = display_device::ExponentialBackoff {.m_initial_delay = 10ms, .m_max_delay = 1ms}});
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Invalid backoff policy specified in RetryScheduler::schedule!")));
+}
+
+TEST_F_S(Schedule, Backoff, DelaysIncrease) {
+  std::vector<int> delays;
+  auto prev = std::chrono::high_resolution_clock::now();
+  m_impl.schedule([&delays, &prev](auto, auto &stop_token) {
+    const auto now = std::chrono::high_resolution_clock::now();
+    delays.push_back(static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(now - prev).count()));
+    prev = now;
+    if (delays.size() == 4) {
+      stop_token.requestStop();
+    }
+  },
+                  {.m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly, .m_backoff = display_device::ExponentialBackoff {.m_initial_delay = 10ms, .m_max_delay = 1000ms}});
+
+  while (m_impl.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  ASSERT_EQ(delays.size(), 4);
+  EXPECT_GE(delays[0], roundTo99(10));
+  EXPECT_GE(delays[1], roundTo99(20));
+  EXPECT_GE(delays[2], roundTo99(40));
+  EXPECT_GE(delays[3], roundTo99(80));
+}
+
+TEST_F_S(Schedule, Backoff, CustomPolicy) {
+  // Policy that is not one of the built-ins, cycling through the given delays
+  struct CyclingBackoff {
+    std::vector<std::chrono::milliseconds> m_delays;
+    std::shared_ptr<std::atomic_int> m_calls;
+
+    [[nodiscard]] std::chrono::milliseconds nextDelay(display_device::BackoffState &state) const {
+      (*m_calls)++;
+      return m_delays[state.m_attempt++ % m_delays.size()];
+    }
+
+    [[nodiscard]] bool isValid() const {
+      return !m_delays.empty();
+    }
+  };
+
+  EXPECT_THAT([&]() {
+    m_impl.schedule([](auto, auto &) {
+    },
+                    {.m_backoff = CyclingBackoff {.m_calls = std::make_shared<std::atomic_int>(0)}});
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Invalid backoff policy specified in RetryScheduler::schedule!")));
+
+  const auto calls {std::make_shared<std::atomic_int>(0)};
+  int counter {0};
+  m_impl.schedule([&counter](auto, auto &stop_token) {
+    if (++counter == 3) {
+      stop_token.requestStop();
+    }
+  },
+                  {.m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly, .m_backoff = CyclingBackoff {.m_delays = {1ms, 2ms}, .m_calls = calls}});
+
+  while (m_impl.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(counter, 3);
+  EXPECT_GE(*calls, 3);
+}
+
+TEST_F_S(Schedule, MaxAttempts, ZeroAttempts) {
+  EXPECT_THAT([&]() {
+    m_impl.schedule([](auto, auto &) {
+    },
+                    {.m_sleep_durations = {1ms}, .m_max_attempts = 0});
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Max attempts specified in RetryScheduler::schedule must be larger than a 0!")));
+}
+
+TEST_F_S(Schedule, MaxAttempts) {
+  auto &logger {display_device::Logger::get()};
+
+  std::string output;
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output = std::string {value};
+  });
+
+  std::atomic_int counter {0};
+  m_impl.schedule([&counter](auto, auto &) {
+    counter++;
+  },
+                  {.m_sleep_durations = {1ms}, .m_max_attempts = 3});
+
+  while (m_impl.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(counter, 3);
+  EXPECT_EQ(output, "RetryScheduler gave up after 3 attempt(s).");
+}
+
+TEST_F_S(Schedule, Deadline, ZeroDeadline) {
+  EXPECT_THAT([&]() {
+    m_impl.schedule([](auto, auto &) {
+    },
+                    {.m_sleep_durations = {1ms}, .m_deadline = 0ms});
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Deadline specified in RetryScheduler::schedule must be larger than a 0!")));
+}
+
+TEST_F_S(Schedule, Deadline) {
+  auto &logger {display_device::Logger::get()};
+
+  std::string output;
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output = std::string {value};
+  });
+
+  std::atomic_int counter {0};
+  m_impl.schedule([&counter](auto, auto &) {
+    counter++;
+  },
+                  {.m_sleep_durations = {20ms}, .m_deadline = 55ms});
+
+  while (m_impl.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  // Immediate call + retries at 20ms and 40ms, the one at 60ms would exceed the deadline
+  EXPECT_EQ(counter, 3);
+  EXPECT_EQ(output, "RetryScheduler gave up after 3 attempt(s) as the deadline would be exceeded.");
+}
+
+TEST_F_S(Schedule, Completion, Success) {
+  std::promise<display_device::SchedulerCompletion> promise;
+  auto future {promise.get_future()};
+  std::atomic_int counter {0};
+  m_impl.schedule([&counter](auto, auto &stop_token) {
+    if (++counter == 3) {
+      stop_token.requestStop();
+    }
+  },
+                  {.m_sleep_durations = {1ms}, .m_on_completion = [&promise](const auto &value) {
+                     promise.set_value(value);
+                   }});
+
+  const auto completion {future.get()};
+  EXPECT_EQ(completion.m_outcome, display_device::SchedulerOutcome::Success);
+  EXPECT_EQ(completion.m_attempts, 3);
+  EXPECT_FALSE(completion.m_exception);
+}
+
+TEST_F_S(Schedule, Completion, SuccessImmediately) {
+  std::optional<display_device::SchedulerCompletion> completion;
+  m_impl.schedule([](auto, auto &stop_token) {
+    stop_token.requestStop();
+  },
+                  {.m_sleep_durations = {1ms}, .m_on_completion = [&completion](const auto &value) {
+                     completion = value;
+                   }});
+
+  ASSERT_TRUE(completion);
+  EXPECT_EQ(completion->m_outcome, display_device::SchedulerOutcome::Success);
+  EXPECT_EQ(completion->m_attempts, 1);
+}
+
+TEST_F_S(Schedule, Completion, Cancelled) {
+  std::vector<display_device::SchedulerCompletion> completions;
+  const auto on_completion {[&completions](const auto &value) {
+    completions.push_back(value);
+  }};
+
+  {
+    display_device::RetryScheduler<TestIface> scheduler {std::make_unique<TestIface>()};
+
+    // Replaced
+    scheduler.schedule([](auto, auto &) {
+    },
+                       {.m_sleep_durations = {1000ms}, .m_on_completion = on_completion});
+    scheduler.schedule([](auto, auto &) {
+    },
+                       {.m_sleep_durations = {1000ms}, .m_on_completion = on_completion});
+    ASSERT_EQ(completions.size(), 1);
+
+    // Cancelled
+    const auto job_id {scheduler.scheduleJob([](auto, auto &) {
+    },
+                                             {.m_sleep_durations = {1000ms}, .m_on_completion = on_completion})};
+    scheduler.cancel(job_id);
+    scheduler.cancel(job_id);
+    ASSERT_EQ(completions.size(), 2);
+
+    // Stopped
+    scheduler.stop();
+    ASSERT_EQ(completions.size(), 3);
+
+    // Destroyed
+    (void) scheduler.scheduleJob([](auto, auto &) {
+    },
+                                 {.m_sleep_durations = {1000ms}, .m_on_completion = on_completion});
+  }
+
+  ASSERT_EQ(completions.size(), 4);
+  for (const auto &completion : completions) {
+    EXPECT_EQ(completion.m_outcome, display_device::SchedulerOutcome::Cancelled);
+    EXPECT_EQ(completion.m_attempts, 1);
+  }
+}
+
+TEST_F_S(Schedule, Completion, AttemptsExhausted) {
+  std::promise<display_device::SchedulerCompletion> promise;
+  auto future {promise.get_future()};
+  m_impl.schedule([](auto, auto &) {
+  },
+                  {.m_sleep_durations = {1ms}, .m_max_attempts = 5, .m_on_completion = [&promise](const auto &value) {
+                     promise.set_value(value);
+                   }});
+
+  const auto completion {future.get()};
+  EXPECT_EQ(completion.m_outcome, display_device::SchedulerOutcome::AttemptsExhausted);
+  EXPECT_EQ(completion.m_attempts, 5);
+}
+
+TEST_F_S(Schedule, Completion, TimedOut) {
+  const auto clock {std::make_shared<display_device::ManualSchedulerClock>()};
+  display_device::RetryScheduler<TestIface> scheduler {std::make_unique<TestIface>(), std::make_shared<display_device::SchedulerExecutor>(0, clock)};
+
+  std::promise<display_device::SchedulerCompletion> promise;
+  auto future {promise.get_future()};
+  std::atomic_int counter {0};
+  scheduler.schedule([&counter](auto, auto &) {
+    counter++;
+  },
+                     {.m_sleep_durations = {10s}, .m_deadline = 30s, .m_on_completion = [&promise](const auto &value) {
+                        promise.set_value(value);
+                      }});
+
+  // Retries at 10s, 20s and 30s, the one at 40s would exceed the deadline
+  for (int i {1}; i <= 3; ++i) {
+    clock->advance(10s);
+    while (counter <= i) {
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+
+  const auto completion {future.get()};
+  EXPECT_EQ(completion.m_outcome, display_device::SchedulerOutcome::TimedOut);
+  EXPECT_EQ(completion.m_attempts, 4);
+}
+
+TEST_F_S(Schedule, Completion, Exception) {
+  auto &logger {display_device::Logger::get()};
+  logger.setCustomCallback([](auto, auto) {
+    // Silence the expected errors
+  });
+
+  std::promise<display_device::SchedulerCompletion> promise;
+  auto future {promise.get_future()};
+  std::atomic_int counter {0};
+  (void) m_impl.scheduleJob([&counter](auto, auto &) {
+    if (++counter == 2) {
+      throw SchedulerStopTokenTestException {};
+    }
+  },
+                            {.m_sleep_durations = {1ms}, .m_on_completion = [&promise](const auto &value) {
+                               promise.set_value(value);
+                             }});
+
+  const auto completion {future.get()};
+  EXPECT_EQ(completion.m_outcome, display_device::SchedulerOutcome::Exception);
+  EXPECT_EQ(completion.m_attempts, 2);
+  EXPECT_THROW(std::rethrow_exception(completion.m_exception), SchedulerStopTokenTestException);
+}
+
+TEST_F_S(Schedule, Completion, InvokedWithoutLock) {
+  std::promise<bool> promise;
+  auto future {promise.get_future()};
+  m_impl.schedule([](auto, auto &stop_token) {
+    stop_token.requestStop();
+  },
+                  {.m_sleep_durations = {1ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly, .m_on_completion = [this, &promise](const auto &) {
+                     // Would deadlock if the scheduler's lock was still held
+                     promise.set_value(m_impl.execute([](TestIface &) {
+                       return true;
+                     }));
+                   }});
+
+  EXPECT_TRUE(future.get());
+}
+
+TEST_F_S(Schedule, Completion, ExceptionThrown) {
+  auto &logger {display_device::Logger::get()};
+
+  std::string output;
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output = std::string {value};
+  });
+
+  m_impl.schedule([](auto, auto &stop_token) {
+    stop_token.requestStop();
+  },
+                  {.m_sleep_durations = {1ms}, .m_on_completion = [](const auto &) {
+                     throw SchedulerStopTokenTestException {};
+                   }});
+
+  EXPECT_FALSE(m_impl.isScheduled());
+  EXPECT_EQ(output, "Exception thrown in the RetryScheduler completion callback. Ignoring. Error:\nGet rekt!");
+}
+
+TEST_F_S(ScheduleJob, NullptrCallbackProvided) {
+  EXPECT_THAT([&]() {
+    (void) m_impl.scheduleJob(nullptr, {.m_sleep_durations = {0ms}});
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Empty callback function provided in RetryScheduler::scheduleJob!")));
+}
+
+TEST_F_S(ScheduleJob, NoDurations) {
+  EXPECT_THAT([&]() {
+    (void) m_impl.scheduleJob([](auto, auto &) {
+    },
+                              {.m_sleep_durations = {}});
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("At least 1 sleep duration must be specified in RetryScheduler::scheduleJob!")));
+}
+
+TEST_F_S(ScheduleJob, ZeroDuration) {
+  EXPECT_THAT([&]() {
+    (void) m_impl.scheduleJob([](auto, auto &) {
+    },
+                              {.m_sleep_durations = {0ms}});
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("All of the durations specified in RetryScheduler::scheduleJob must be larger than a 0!")));
+}
+
+TEST_F_S(ScheduleJob, IndependentCadences) {
+  std::atomic_int counter_fast {0};
+  std::atomic_int counter_slow {0};
+  std::atomic_int counter_primary {0};
+
+  m_impl.schedule([&counter_primary](auto, auto &) {
+    counter_primary++;
+  },
+                  {.m_sleep_durations = {5ms}});
+  const auto fast_job {m_impl.scheduleJob([&counter_fast](auto, auto &) {
+    counter_fast++;
+  },
+                                          {.m_sleep_durations = {2ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly})};
+  const auto slow_job {m_impl.scheduleJob([&counter_slow](auto, auto &) {
+    counter_slow++;
+  },
+                                          {.m_sleep_durations = {60ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly})};
+
+  EXPECT_NE(fast_job, slow_job);
+  while (counter_slow < 1) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_TRUE(m_impl.isScheduled(fast_job));
+  EXPECT_TRUE(m_impl.isScheduled(slow_job));
+  EXPECT_GT(counter_fast, counter_slow * 5);
+  EXPECT_GT(counter_primary, counter_slow * 2);
+
+  // Replacing the primary function does not affect the jobs
+  m_impl.schedule([](auto, auto &) {
+  },
+                  {.m_sleep_durations = {1ms}});
+  EXPECT_TRUE(m_impl.isScheduled(fast_job));
+  EXPECT_TRUE(m_impl.isScheduled(slow_job));
+
+  // Stop the scheduler to avoid SEGFAULTS
+  m_impl.stop();
+  EXPECT_FALSE(m_impl.isScheduled());
+  EXPECT_FALSE(m_impl.isScheduled(fast_job));
+  EXPECT_FALSE(m_impl.isScheduled(slow_job));
+}
+
+TEST_F_S(ScheduleJob, StopTokenStopsOnlyTheJob) {
+  std::atomic_int counter_a {0};
+  std::atomic_int counter_b {0};
+
+  const auto job_a {m_impl.scheduleJob([&counter_a](auto, auto &stop_token) {
+    if (++counter_a == 3) {
+      stop_token.requestStop();
+    }
+  },
+                                       {.m_sleep_durations = {1ms}})};
+  const auto job_b {m_impl.scheduleJob([&counter_b](auto, auto &) {
+    counter_b++;
+  },
+                                       {.m_sleep_durations = {1ms}})};
+
+  while (m_impl.isScheduled(job_a)) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  const int counter_b_value {counter_b};
+  while (counter_b < counter_b_value + 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(counter_a, 3);
+  EXPECT_TRUE(m_impl.isScheduled());
+  EXPECT_TRUE(m_impl.isScheduled(job_b));
+
+  // Stop the scheduler to avoid SEGFAULTS
+  m_impl.stop();
+}
+
+TEST_F_S(ScheduleJob, StoppedImmediately) {
+  const auto job_id {m_impl.scheduleJob([](auto, auto &stop_token) {
+    stop_token.requestStop();
+  },
+                                        {.m_sleep_durations = {1000ms}})};
+
+  EXPECT_FALSE(m_impl.isScheduled(job_id));
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(ScheduleJob, ExceptionThrown) {
+  auto &logger {display_device::Logger::get()};
+
+  std::string output;
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output = std::string {value};
+  });
+
+  std::atomic_int counter {0};
+  const auto failing_job {m_impl.scheduleJob([&counter](auto, auto &) {
+    if (++counter > 1) {
+      throw SchedulerStopTokenTestException {};
+    }
+  },
+                                             {.m_sleep_durations = {1ms}})};
+  const auto other_job {m_impl.scheduleJob([](auto, auto &) {
+  },
+                                           {.m_sleep_durations = {1ms}})};
+
+  while (m_impl.isScheduled(failing_job)) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_TRUE(m_impl.isScheduled(other_job));
+  EXPECT_EQ(output, "Exception thrown in the RetryScheduler thread. Stopping job. Error:\nGet rekt!");
+
+  // Stop the scheduler to avoid SEGFAULTS
+  m_impl.stop();
+}
+
+TEST_F_S(Cancel) {
+  std::atomic_int counter_a {0};
+  std::atomic_int counter_b {0};
+
+  const auto job_a {m_impl.scheduleJob([&counter_a](auto, auto &) {
+    counter_a++;
+  },
+                                       {.m_sleep_durations = {1ms}})};
+  const auto job_b {m_impl.scheduleJob([&counter_b](auto, auto &) {
+    counter_b++;
+  },
+                                       {.m_sleep_durations = {1ms}})};
+  while (counter_a < 3 || counter_b < 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  m_impl.cancel(job_a);
+  EXPECT_FALSE(m_impl.isScheduled(job_a));
+  EXPECT_TRUE(m_impl.isScheduled(job_b));
+
+  const int counter_a_value {counter_a};
+  const int counter_b_value {counter_b};
+  while (counter_b < counter_b_value + 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(counter_a, counter_a_value);
+
+  // Cancelling twice is a no-op
+  m_impl.cancel(job_a);
+  m_impl.cancel(job_b);
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
 TEST_F_S(Execute, NonConst, NullptrCallbackProvided) {
   EXPECT_THAT([this]() {
     auto &non_const_impl {m_impl};
@@ -575,6 +1099,171 @@ TEST_F_S(Execute, ConstVsNonConst, WithStopToken) {
   static_assert(!std::is_invocable_v<decltype(non_const_non_const_callback_auto), const TestIface &, const display_device::SchedulerStopToken &>);
 }
 
+TEST_F_S(ExecuteAsync, NullptrCallbackProvided) {
+  EXPECT_THAT([this]() {
+    (void) m_impl.executeAsync(std::function<void(TestIface &)> {});
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Empty callback function provided in RetryScheduler::executeAsync!")));
+}
+
+TEST_F_S(ExecuteAsync, DoesNotBlockCaller) {
+  std::atomic_bool job_started {false};
+  m_impl.schedule([&job_started](auto, auto &stop_token) {
+    job_started = true;
+    std::this_thread::sleep_for(100ms);
+    stop_token.requestStop();
+  },
+                  {.m_sleep_durations = {1ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+  while (!job_started) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  const auto calling_thread_id {std::this_thread::get_id()};
+  const auto start {std::chrono::steady_clock::now()};
+  auto future {m_impl.executeAsync([](TestIface &iface) {
+    iface.m_durations.push_back(123);
+    return std::this_thread::get_id();
+  })};
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 50ms);
+
+  EXPECT_NE(future.get(), calling_thread_id);
+  EXPECT_FALSE(m_impl.isScheduled());
+  EXPECT_EQ(m_impl.execute([](const TestIface &iface) {
+    return iface.m_durations;
+  }),
+            std::vector<int> {123});
+}
+
+TEST_F_S(ExecuteAsync, Const) {
+  const auto &const_impl {m_impl};
+  auto future {const_impl.executeAsync([](const TestIface &iface) {
+    return iface.m_durations.size();
+  })};
+
+  EXPECT_EQ(future.get(), 0);
+}
+
+TEST_F_S(ExecuteAsync, StopToken) {
+  std::atomic_int counter {0};
+  m_impl.schedule([&counter](auto, auto &) {
+    counter++;
+  },
+                  {.m_sleep_durations = {1ms}});
+  while (counter < 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  m_impl.executeAsync([](auto, auto &stop_token) {
+                   stop_token.requestStop();
+                 })
+    .get();
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(ExecuteAsync, ExceptionThrown) {
+  auto future {m_impl.executeAsync([](auto) {
+    throw std::runtime_error("Get rekt!");
+  })};
+
+  EXPECT_THAT([&future]() {
+    future.get();
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Get rekt!")));
+}
+
+TEST_F_S(ExecuteAsync, BrokenPromiseOnDestruction) {
+  auto scheduler {std::make_unique<display_device::RetryScheduler<TestIface>>(std::make_unique<TestIface>())};
+
+  std::atomic_bool job_started {false};
+  scheduler->schedule([&job_started](auto, auto &) {
+    job_started = true;
+    std::this_thread::sleep_for(50ms);
+  },
+                      {.m_sleep_durations = {1ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+  while (!job_started) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  auto future {scheduler->executeAsync([](auto) {
+    return 1;
+  })};
+  std::thread destroyer {[&scheduler]() {
+    scheduler.reset();
+  }};
+  destroyer.join();
+
+  // Depending on timing, the task is either executed before the destruction or dropped
+  try {
+    EXPECT_EQ(future.get(), 1);
+  } catch (const std::future_error &error) {
+    EXPECT_EQ(error.code(), std::future_errc::broken_promise);
+  }
+}
+
+TEST_F_S(CoExecute) {
+  std::promise<std::pair<std::thread::id, int>> result;
+  std::promise<std::string> error;
+  const auto coroutine {[this, &result, &error]() -> TestTask {
+    const int value {co_await m_impl.coExecute([](TestIface &iface) {
+      iface.m_durations.push_back(5);
+      return static_cast<int>(iface.m_durations.size());
+    })};
+    result.set_value({std::this_thread::get_id(), value});
+
+    try {
+      co_await m_impl.coExecute([](auto) {
+        throw std::runtime_error("Get rekt!");
+      });
+    } catch (const std::runtime_error &exception) {
+      error.set_value(exception.what());
+    }
+  }};
+
+  coroutine();
+  const auto [thread_id, value] {result.get_future().get()};
+  EXPECT_NE(thread_id, std::this_thread::get_id());
+  EXPECT_EQ(value, 1);
+  EXPECT_EQ(error.get_future().get(), "Get rekt!");
+}
+
+TEST_F_S(CoExecute, ExceptionOnDestruction) {
+  // The other scheduler blocks the only thread of the shared executor, so the task cannot run
+  const auto executor {std::make_shared<display_device::SchedulerExecutor>(0)};
+  display_device::RetryScheduler<TestIface> blocking_scheduler {std::make_unique<TestIface>(), executor};
+  auto scheduler {std::make_unique<display_device::RetryScheduler<TestIface>>(std::make_unique<TestIface>(), executor)};
+
+  std::promise<void> job_started;
+  std::promise<void> release_job;
+  blocking_scheduler.schedule([&job_started, release = release_job.get_future().share()](auto, auto &stop_token) {
+    job_started.set_value();
+    release.wait();
+    stop_token.requestStop();
+  },
+                              {.m_sleep_durations = {1ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+  job_started.get_future().wait();
+
+  bool callback_invoked {false};
+  std::optional<std::string> error;
+  const auto coroutine {[&scheduler, &callback_invoked, &error]() -> TestTask {
+    try {
+      co_await scheduler->coExecute([&callback_invoked](auto) {
+        callback_invoked = true;
+      });
+    } catch (const std::runtime_error &exception) {
+      error = exception.what();
+    }
+  }};
+
+  coroutine();
+  EXPECT_FALSE(error);
+
+  scheduler.reset();
+  release_job.set_value();
+
+  EXPECT_FALSE(callback_invoked);
+  EXPECT_EQ(error, "RetryScheduler was destroyed before executing the callback in RetryScheduler::coExecute!");
+}
+
 TEST_F_S(Stop) {
   EXPECT_FALSE(m_impl.isScheduled());
   m_impl.stop();
@@ -615,6 +1304,311 @@ TEST_F_S(ThreadCleanupInDestructor) {
   EXPECT_EQ(counter_before_sleep, counter_after_sleep);
 }
 
+TEST_F_S(SharedExecutor) {
+  const auto executor {std::make_shared<display_device::SchedulerExecutor>(1)};
+
+  std::vector<std::unique_ptr<display_device::RetryScheduler<TestIface>>> schedulers;
+  std::vector<std::atomic_int> counters(10);
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+  for (auto &counter : counters) {
+    auto &scheduler {schedulers.emplace_back(std::make_unique<display_device::RetryScheduler<TestIface>>(std::make_unique<TestIface>(), executor))};
+    scheduler->schedule([&counter, &thread_ids_mutex, &thread_ids](auto, auto &) {
+      counter++;
+      std::lock_guard lock {thread_ids_mutex};
+      thread_ids.insert(std::this_thread::get_id());
+    },
+                        {.m_sleep_durations = {1ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+  }
+
+  for (const auto &counter : counters) {
+    while (counter < 3) {
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+
+  {
+    // All of the schedulers are served by the same worker thread
+    std::lock_guard lock {thread_ids_mutex};
+    EXPECT_EQ(thread_ids.size(), 1);
+    EXPECT_FALSE(thread_ids.contains(std::this_thread::get_id()));
+  }
+
+  // Stopping one scheduler does not affect the others
+  schedulers.front()->stop();
+  EXPECT_FALSE(schedulers.front()->isScheduled());
+
+  const int stopped_counter_value {counters.front()};
+  const int running_counter_value {counters.back()};
+  while (counters.back() < running_counter_value + 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(counters.front(), stopped_counter_value);
+
+  // Destroying the schedulers detaches them from the executor
+  schedulers.clear();
+  const int counter_before_sleep {counters.back()};
+  std::this_thread::sleep_for(20ms);
+  EXPECT_EQ(counters.back(), counter_before_sleep);
+}
+
+TEST_F_S(VirtualTime, Schedule) {
+  const auto clock {std::make_shared<display_device::ManualSchedulerClock>()};
+  display_device::RetryScheduler<TestIface> scheduler {std::make_unique<TestIface>(), std::make_shared<display_device::SchedulerExecutor>(0, clock)};
+
+  const auto start {clock->now()};
+  std::mutex mutex;
+  std::vector<std::chrono::nanoseconds> call_times;
+  const auto wait_for_calls {[&](const std::size_t count) {
+    while (true) {
+      {
+        std::lock_guard lock {mutex};
+        if (call_times.size() >= count) {
+          return;
+        }
+      }
+      std::this_thread::sleep_for(1ms);
+    }
+  }};
+
+  scheduler.schedule([&](auto, auto &) {
+    std::lock_guard lock {mutex};
+    call_times.push_back(clock->now() - start);
+  },
+                     {.m_sleep_durations = {1h, 2h}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+
+  clock->advance(1h);
+  wait_for_calls(1);
+  clock->advance(2h);
+  wait_for_calls(2);
+  clock->advance(2h);
+  wait_for_calls(3);
+
+  scheduler.stop();
+  EXPECT_EQ(call_times, (std::vector<std::chrono::nanoseconds> {1h, 3h, 5h}));
+}
+
+TEST_F_S(VirtualTime, ImmediateWithSleep) {
+  const auto clock {std::make_shared<display_device::ManualSchedulerClock>()};
+  display_device::RetryScheduler<TestIface> scheduler {std::make_unique<TestIface>(), std::make_shared<display_device::SchedulerExecutor>(0, clock)};
+
+  const auto start {clock->now()};
+  std::optional<std::chrono::nanoseconds> call_time;
+  scheduler.schedule([&](auto, auto &stop_token) {
+    call_time = clock->now() - start;
+    stop_token.requestStop();
+  },
+                     {.m_sleep_durations = {24h}, .m_execution = display_device::SchedulerOptions::Execution::ImmediateWithSleep});
+
+  EXPECT_EQ(call_time, std::chrono::nanoseconds {24h});
+}
+
+TEST_F_S(Trigger) {
+  const auto clock {std::make_shared<display_device::ManualSchedulerClock>()};
+  display_device::RetryScheduler<TestIface> scheduler {std::make_unique<TestIface>(), std::make_shared<display_device::SchedulerExecutor>(0, clock)};
+
+  std::atomic_int counter_a {0};
+  std::atomic_int counter_b {0};
+  scheduler.schedule([&counter_a](auto, auto &) {
+    counter_a++;
+  },
+                     {.m_sleep_durations = {24h}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+  (void) scheduler.scheduleJob([&counter_b](auto, auto &) {
+    counter_b++;
+  },
+                               {.m_sleep_durations = {24h}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+
+  // The time does not move, but the functions are executed anyway
+  scheduler.trigger();
+  while (counter_a < 1 || counter_b < 1) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  // Nothing is executed until the next trigger or the full sleep
+  std::this_thread::sleep_for(10ms);
+  EXPECT_EQ(counter_a, 1);
+  EXPECT_EQ(counter_b, 1);
+
+  clock->advance(24h);
+  while (counter_a < 2 || counter_b < 2) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  scheduler.stop();
+}
+
+TEST_F_S(Trigger, SpecificJob) {
+  const auto clock {std::make_shared<display_device::ManualSchedulerClock>()};
+  display_device::RetryScheduler<TestIface> scheduler {std::make_unique<TestIface>(), std::make_shared<display_device::SchedulerExecutor>(0, clock)};
+
+  std::atomic_int counter_a {0};
+  std::atomic_int counter_b {0};
+  const auto job_a {scheduler.scheduleJob([&counter_a](auto, auto &) {
+    counter_a++;
+  },
+                                          {.m_sleep_durations = {24h}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly})};
+  (void) scheduler.scheduleJob([&counter_b](auto, auto &) {
+    counter_b++;
+  },
+                               {.m_sleep_durations = {24h}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+
+  scheduler.trigger(job_a);
+  while (counter_a < 1) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  std::this_thread::sleep_for(10ms);
+  EXPECT_EQ(counter_a, 1);
+  EXPECT_EQ(counter_b, 0);
+
+  scheduler.stop();
+}
+
+TEST_F_S(Trigger, Coalesced) {
+  const auto clock {std::make_shared<display_device::ManualSchedulerClock>()};
+  display_device::RetryScheduler<TestIface> scheduler {std::make_unique<TestIface>(), std::make_shared<display_device::SchedulerExecutor>(0, clock)};
+
+  std::atomic_int counter {0};
+  std::atomic_int scheduler_counter {0};
+  scheduler.schedule([&counter](auto, auto &) {
+    counter++;
+  },
+                     {.m_sleep_durations = {24h}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+
+  // Triggers queued before the scheduler thread gets to them are coalesced into a single retry
+  scheduler.executeAsync([&scheduler, &scheduler_counter](auto &) {
+    scheduler.trigger();
+    scheduler.trigger();
+    scheduler.trigger();
+    scheduler_counter++;
+  });
+  while (counter < 1 || scheduler_counter < 1) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  std::this_thread::sleep_for(10ms);
+  EXPECT_EQ(counter, 1);
+
+  scheduler.stop();
+}
+
+TEST_F_S(Trigger, NothingScheduled) {
+  std::atomic_int counter {0};
+  m_impl.trigger();
+  m_impl.executeAsync([&counter](auto &) {
+    counter++;
+  }).wait();
+
+  EXPECT_EQ(counter, 1);
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(Metrics) {
+  auto &logger {display_device::Logger::get()};
+  logger.setCustomCallback([](auto, auto) {
+    // Silence the expected errors
+  });
+
+  const auto clock {std::make_shared<display_device::ManualSchedulerClock>()};
+  const auto metrics {std::make_shared<display_device::SchedulerMetrics>()};
+  display_device::RetryScheduler<TestIface> scheduler {std::make_unique<TestIface>(), std::make_shared<display_device::SchedulerExecutor>(0, clock), metrics};
+
+  // Succeeds on the 3rd attempt, 2 hours after scheduling
+  std::atomic_int counter {0};
+  scheduler.schedule([&counter](auto, auto &stop_token) {
+    if (++counter == 3) {
+      stop_token.requestStop();
+    }
+  },
+                     {.m_sleep_durations = {1h}});
+  clock->advance(1h);
+  while (counter < 2) {
+    std::this_thread::sleep_for(1ms);
+  }
+  clock->advance(1h);
+  while (scheduler.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  // Gives up after the only allowed attempt
+  scheduler.schedule([](auto, auto &) {
+  },
+                     {.m_sleep_durations = {1h}, .m_execution = display_device::SchedulerOptions::Execution::ImmediateWithSleep, .m_max_attempts = 1});
+
+  // Throws immediately
+  scheduler.schedule([](auto, auto &) {
+    throw SchedulerStopTokenTestException {};
+  },
+                     {.m_sleep_durations = {1h}});
+
+  scheduler.execute([](auto &) {
+  });
+
+  const auto snapshot {metrics->snapshot()};
+  EXPECT_EQ(snapshot.m_schedules, 3);
+  EXPECT_EQ(snapshot.m_attempts, 5);
+  EXPECT_EQ(snapshot.m_successes, 1);
+  EXPECT_EQ(snapshot.m_give_ups, 1);
+  EXPECT_EQ(snapshot.m_exceptions, 1);
+  EXPECT_EQ(snapshot.m_attempts_per_schedule.m_sum, 5);
+  EXPECT_EQ(snapshot.m_time_to_success_us.m_sum, std::chrono::duration_cast<std::chrono::microseconds>(2h).count());
+  EXPECT_EQ(snapshot.m_callback_duration_us.m_count, 5);
+  EXPECT_EQ(snapshot.m_mutex_wait_us.m_count, 1);
+}
+
+TEST_F_S(SharedMutex, ConstExecuteRunsConcurrently) {
+  display_device::RetryScheduler<TestIface, std::shared_mutex> scheduler {std::make_unique<TestIface>()};
+
+  // Both of the callbacks must be inside the lock at the same time to finish
+  std::atomic_int inside {0};
+  const auto wait_for_each_other {[&scheduler, &inside]() {
+    return std::as_const(scheduler).execute([&inside](const TestIface &) {
+      inside++;
+      const auto deadline {std::chrono::steady_clock::now() + 1s};
+      while (inside < 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(1ms);
+      }
+      return inside == 2;
+    });
+  }};
+
+  auto future {std::async(std::launch::async, wait_for_each_other)};
+  EXPECT_TRUE(wait_for_each_other());
+  EXPECT_TRUE(future.get());
+}
+
+TEST_F_S(SharedMutex, NonConstExecuteIsExclusive) {
+  display_device::RetryScheduler<TestIface, std::shared_mutex> scheduler {std::make_unique<TestIface>()};
+
+  std::atomic_int shared_count {0};
+  std::atomic_bool exclusive {false};
+  std::atomic_bool violated {false};
+  const auto execute {[&]() {
+    for (int i {0}; i < 10; ++i) {
+      std::as_const(scheduler).execute([&](const TestIface &) {
+        shared_count++;
+        violated = violated || exclusive;
+        std::this_thread::sleep_for(1ms);
+        shared_count--;
+      });
+      scheduler.execute([&](TestIface &iface) {
+        exclusive = true;
+        violated = violated || shared_count > 0;
+        iface.nonConstMethod();
+        std::this_thread::sleep_for(1ms);
+        violated = violated || shared_count > 0;
+        exclusive = false;
+      });
+    }
+  }};
+
+  auto future {std::async(std::launch::async, execute)};
+  execute();
+  future.get();
+
+  EXPECT_FALSE(violated);
+}
+
 TEST_F_S(SchedulerStopToken, DestructorNoThrow) {
   EXPECT_NO_THROW({
     display_device::SchedulerStopToken token {[]() {
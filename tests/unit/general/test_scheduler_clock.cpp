@@ -0,0 +1,90 @@
+// system includes
+#include <future>
+
+// local includes
+#include "display_device/manual_scheduler_clock.h"
+#include "display_device/steady_scheduler_clock.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  using namespace std::chrono_literals;
+
+  // Test fixture(s) for this file
+  class SchedulerClockTest: public BaseTest {};
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, SchedulerClockTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(Steady, SleepUntil) {
+  display_device::SteadySchedulerClock clock;
+
+  const auto start {clock.now()};
+  clock.sleepUntil(start + 10ms);
+  EXPECT_GE(clock.now() - start, 10ms);
+}
+
+TEST_F_S(Steady, WaitUntil) {
+  display_device::SteadySchedulerClock clock;
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  std::unique_lock lock {mutex};
+  const auto start {clock.now()};
+  while (clock.now() < start + 10ms) {
+    clock.waitUntil(cv, lock, start + 10ms);
+  }
+  EXPECT_GE(clock.now() - start, 10ms);
+}
+
+TEST_F_S(Manual, Advance) {
+  const display_device::ManualSchedulerClock::TimePoint start {1h};
+  display_device::ManualSchedulerClock clock {start};
+  EXPECT_EQ(clock.now(), start);
+
+  clock.advance(5ms);
+  EXPECT_EQ(clock.now(), start + 5ms);
+
+  clock.advanceTo(start + 1h);
+  EXPECT_EQ(clock.now(), start + 1h);
+
+  // Time cannot go backwards
+  clock.advanceTo(start);
+  EXPECT_EQ(clock.now(), start + 1h);
+}
+
+TEST_F_S(Manual, SleepUntilAdvances) {
+  display_device::ManualSchedulerClock clock;
+
+  const auto start {clock.now()};
+  clock.sleepUntil(start + 24h);
+  EXPECT_EQ(clock.now(), start + 24h);
+}
+
+TEST_F_S(Manual, WaitUntil, AlreadyReached) {
+  display_device::ManualSchedulerClock clock;
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  std::unique_lock lock {mutex};
+  clock.waitUntil(cv, lock, clock.now());
+  EXPECT_TRUE(lock.owns_lock());
+}
+
+TEST_F_S(Manual, WaitUntil, WokenUpByAdvance) {
+  display_device::ManualSchedulerClock clock;
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  const auto deadline {clock.now() + 1h};
+  auto future {std::async(std::launch::async, [&]() {
+    std::unique_lock lock {mutex};
+    while (clock.now() < deadline) {
+      clock.waitUntil(cv, lock, deadline);
+    }
+  })};
+
+  EXPECT_EQ(future.wait_for(10ms), std::future_status::timeout);
+  clock.advance(1h);
+  EXPECT_EQ(future.wait_for(1s), std::future_status::ready);
+}
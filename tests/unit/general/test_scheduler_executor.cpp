@@ -0,0 +1,303 @@
+// system includes
+#include <atomic>
+#include <gmock/gmock.h>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// local includes
+#include "display_device/manual_scheduler_clock.h"
+#include "display_device/scheduler_executor.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  using namespace std::chrono_literals;
+
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Test fixture(s) for this file
+  class SchedulerExecutorTest: public BaseTest {
+  public:
+    static void waitUntil(const std::function<bool()> &predicate) {
+      while (!predicate()) {
+        std::this_thread::sleep_for(1ms);
+      }
+    }
+
+    static auto inMs(const std::chrono::milliseconds duration) {
+      return std::chrono::steady_clock::now() + duration;
+    }
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, SchedulerExecutorTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(AddClient, NullptrCallbackProvided) {
+  display_device::SchedulerExecutor executor {0};
+  EXPECT_THAT([&]() {
+    (void) executor.addClient(nullptr);
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Empty callback function provided in SchedulerExecutor::addClient!")));
+}
+
+TEST_F_S(Arm, CallbackInvokedOnce) {
+  display_device::SchedulerExecutor executor {0};
+
+  std::atomic_int counter {0};
+  const auto client_id {executor.addClient([&counter]() {
+    counter++;
+  })};
+
+  executor.arm(client_id, inMs(5ms));
+  waitUntil([&counter]() {
+    return counter == 1;
+  });
+
+  std::this_thread::sleep_for(20ms);
+  EXPECT_EQ(counter, 1);
+
+  executor.removeClient(client_id);
+}
+
+TEST_F_S(Arm, DeadlineReplaced) {
+  display_device::SchedulerExecutor executor {0};
+
+  std::atomic_int counter {0};
+  const auto client_id {executor.addClient([&counter]() {
+    counter++;
+  })};
+
+  executor.arm(client_id, inMs(5ms));
+  executor.arm(client_id, inMs(1000ms));
+  std::this_thread::sleep_for(20ms);
+  EXPECT_EQ(counter, 0);
+
+  executor.arm(client_id, inMs(1ms));
+  waitUntil([&counter]() {
+    return counter == 1;
+  });
+
+  executor.removeClient(client_id);
+}
+
+TEST_F_S(Arm, DeadlinesOrdered) {
+  display_device::SchedulerExecutor executor {0};
+
+  std::mutex mutex;
+  std::vector<int> order;
+  const auto make_client {[&](const int value) {
+    return executor.addClient([&mutex, &order, value]() {
+      std::lock_guard lock {mutex};
+      order.push_back(value);
+    });
+  }};
+
+  const auto client_a {make_client(1)};
+  const auto client_b {make_client(2)};
+  const auto client_c {make_client(3)};
+
+  executor.arm(client_c, inMs(30ms));
+  executor.arm(client_a, inMs(10ms));
+  executor.arm(client_b, inMs(20ms));
+  waitUntil([&]() {
+    std::lock_guard lock {mutex};
+    return order.size() == 3;
+  });
+
+  EXPECT_EQ(order, (std::vector<int> {1, 2, 3}));
+
+  executor.removeClient(client_a);
+  executor.removeClient(client_b);
+  executor.removeClient(client_c);
+}
+
+TEST_F_S(Disarm) {
+  display_device::SchedulerExecutor executor {0};
+
+  std::atomic_int counter {0};
+  const auto client_id {executor.addClient([&counter]() {
+    counter++;
+  })};
+
+  executor.arm(client_id, inMs(10ms));
+  executor.disarm(client_id);
+  std::this_thread::sleep_for(30ms);
+  EXPECT_EQ(counter, 0);
+
+  executor.removeClient(client_id);
+}
+
+TEST_F_S(RemoveClient, WaitsForRunningCallback) {
+  display_device::SchedulerExecutor executor {0};
+
+  std::atomic_bool started {false};
+  std::atomic_bool finished {false};
+  const auto client_id {executor.addClient([&started, &finished]() {
+    started = true;
+    std::this_thread::sleep_for(30ms);
+    finished = true;
+  })};
+
+  executor.arm(client_id, inMs(1ms));
+  waitUntil([&started]() {
+    return started.load();
+  });
+
+  executor.removeClient(client_id);
+  EXPECT_TRUE(finished);
+
+  // Detached clients are no longer scheduled
+  executor.arm(client_id, inMs(1ms));
+  executor.removeClient(client_id);
+}
+
+TEST_F_S(RemoveClient, ClientsAddedWhileWaiting) {
+  display_device::SchedulerExecutor executor {0};
+
+  std::atomic_bool started {false};
+  std::atomic_bool release {false};
+  const auto client_id {executor.addClient([&started, &release]() {
+    started = true;
+    waitUntil([&release]() {
+      return release.load();
+    });
+  })};
+
+  executor.arm(client_id, inMs(1ms));
+  waitUntil([&started]() {
+    return started.load();
+  });
+
+  // Enough clients are added while removeClient is waiting to force the map to rehash
+  std::vector<display_device::SchedulerExecutor::ClientId> added_clients;
+  std::thread remover {[&executor, client_id]() {
+    executor.removeClient(client_id);
+  }};
+  for (int i {0}; i < 256; ++i) {
+    added_clients.push_back(executor.addClient([]() {}));
+  }
+  release = true;
+  remover.join();
+
+  for (const auto added_client : added_clients) {
+    executor.removeClient(added_client);
+  }
+}
+
+TEST_F_S(WorkerPool, DefaultWorkerCount) {
+  const display_device::SchedulerExecutor executor;
+  EXPECT_EQ(executor.getWorkerCount(), display_device::SchedulerExecutor::m_default_worker_count);
+  EXPECT_GT(executor.getWorkerCount(), 0);
+}
+
+TEST_F_S(WorkerPool, CallbacksInvokedInWorkers) {
+  display_device::SchedulerExecutor executor {2};
+  EXPECT_EQ(executor.getWorkerCount(), 2);
+
+  std::mutex mutex;
+  std::set<std::thread::id> thread_ids;
+  std::atomic_int counter {0};
+  const auto make_client {[&]() {
+    return executor.addClient([&]() {
+      {
+        std::lock_guard lock {mutex};
+        thread_ids.insert(std::this_thread::get_id());
+      }
+      std::this_thread::sleep_for(20ms);
+      counter++;
+    });
+  }};
+
+  const auto client_a {make_client()};
+  const auto client_b {make_client()};
+
+  executor.arm(client_a, inMs(1ms));
+  executor.arm(client_b, inMs(1ms));
+  waitUntil([&counter]() {
+    return counter == 2;
+  });
+
+  EXPECT_EQ(thread_ids.size(), 2);
+  EXPECT_FALSE(thread_ids.contains(std::this_thread::get_id()));
+
+  executor.removeClient(client_a);
+  executor.removeClient(client_b);
+}
+
+TEST_F_S(WorkerPool, CallbackNotInvokedConcurrently) {
+  display_device::SchedulerExecutor executor {2};
+
+  std::atomic_int running {0};
+  std::atomic_int max_running {0};
+  std::atomic_int counter {0};
+  display_device::SchedulerExecutor::ClientId client_id {};
+  client_id = executor.addClient([&]() {
+    max_running = std::max(max_running.load(), ++running);
+    executor.arm(client_id, inMs(0ms));
+    std::this_thread::sleep_for(5ms);
+    counter++;
+    running--;
+  });
+
+  executor.arm(client_id, inMs(1ms));
+  waitUntil([&counter]() {
+    return counter >= 3;
+  });
+
+  executor.removeClient(client_id);
+  EXPECT_EQ(max_running, 1);
+}
+
+TEST_F_S(ManualClock) {
+  const auto clock {std::make_shared<display_device::ManualSchedulerClock>()};
+  display_device::SchedulerExecutor executor {0, clock};
+  EXPECT_EQ(&executor.getClock(), clock.get());
+
+  std::atomic_int counter {0};
+  const auto client_id {executor.addClient([&counter]() {
+    counter++;
+  })};
+
+  executor.arm(client_id, clock->now() + 1h);
+  std::this_thread::sleep_for(10ms);
+  EXPECT_EQ(counter, 0);
+
+  clock->advance(59min);
+  std::this_thread::sleep_for(10ms);
+  EXPECT_EQ(counter, 0);
+
+  clock->advance(1min);
+  waitUntil([&counter]() {
+    return counter == 1;
+  });
+
+  executor.removeClient(client_id);
+}
+
+TEST_F_S(ExceptionThrown) {
+  auto &logger {display_device::Logger::get()};
+
+  std::string output;
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output = std::string {value};
+  });
+
+  display_device::SchedulerExecutor executor {0};
+
+  std::atomic_int counter {0};
+  const auto client_id {executor.addClient([&counter]() {
+    counter++;
+    throw std::runtime_error {"Get rekt!"};
+  })};
+
+  executor.arm(client_id, inMs(1ms));
+  waitUntil([&counter]() {
+    return counter == 1;
+  });
+  executor.removeClient(client_id);
+
+  EXPECT_EQ(output, "Exception thrown in the SchedulerExecutor callback. Ignoring. Error:\nGet rekt!");
+}
@@ -0,0 +1,101 @@
+// system includes
+#include <limits>
+
+// local includes
+#include "display_device/scheduler_metrics.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  using namespace std::chrono_literals;
+
+  // Test fixture(s) for this file
+  class SchedulerMetricsTest: public BaseTest {};
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, SchedulerMetricsTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(Histogram, BucketUpperBounds) {
+  using display_device::MetricsHistogramSnapshot;
+
+  EXPECT_EQ(MetricsHistogramSnapshot::getBucketUpperBound(0), 0);
+  EXPECT_EQ(MetricsHistogramSnapshot::getBucketUpperBound(1), 1);
+  EXPECT_EQ(MetricsHistogramSnapshot::getBucketUpperBound(2), 3);
+  EXPECT_EQ(MetricsHistogramSnapshot::getBucketUpperBound(10), 1023);
+  EXPECT_EQ(MetricsHistogramSnapshot::getBucketUpperBound(MetricsHistogramSnapshot::m_bucket_count - 1), std::numeric_limits<std::uint64_t>::max());
+}
+
+TEST_F_S(Histogram, Record) {
+  display_device::MetricsHistogram histogram;
+  histogram.record(0);
+  histogram.record(1);
+  histogram.record(3);
+  histogram.record(4);
+  histogram.record(std::numeric_limits<std::uint64_t>::max() / 2);
+
+  const auto snapshot {histogram.snapshot()};
+  EXPECT_EQ(snapshot.m_count, 5);
+  EXPECT_EQ(snapshot.m_sum, 8 + std::numeric_limits<std::uint64_t>::max() / 2);
+  EXPECT_EQ(snapshot.m_max, std::numeric_limits<std::uint64_t>::max() / 2);
+  EXPECT_EQ(snapshot.m_buckets[0], 1);
+  EXPECT_EQ(snapshot.m_buckets[1], 1);
+  EXPECT_EQ(snapshot.m_buckets[2], 1);
+  EXPECT_EQ(snapshot.m_buckets[3], 1);
+  EXPECT_EQ(snapshot.m_buckets.back(), 1);
+}
+
+TEST_F_S(Histogram, RecordDuration) {
+  display_device::MetricsHistogram histogram;
+  histogram.recordDuration(1500us);
+  histogram.recordDuration(-5ms);
+
+  const auto snapshot {histogram.snapshot()};
+  EXPECT_EQ(snapshot.m_count, 2);
+  EXPECT_EQ(snapshot.m_sum, 1500);
+  EXPECT_EQ(snapshot.m_max, 1500);
+  EXPECT_EQ(snapshot.m_buckets[0], 1);
+}
+
+TEST_F_S(Histogram, Percentile) {
+  display_device::MetricsHistogram histogram;
+  EXPECT_EQ(histogram.snapshot().getPercentile(50), 0);
+
+  for (int i {0}; i < 90; ++i) {
+    histogram.record(10);
+  }
+  for (int i {0}; i < 10; ++i) {
+    histogram.record(1000);
+  }
+
+  const auto snapshot {histogram.snapshot()};
+  EXPECT_EQ(snapshot.getPercentile(0), 15);
+  EXPECT_EQ(snapshot.getPercentile(50), 15);
+  EXPECT_EQ(snapshot.getPercentile(90), 15);
+  EXPECT_EQ(snapshot.getPercentile(99), 1000);
+  EXPECT_EQ(snapshot.getPercentile(100), 1000);
+}
+
+TEST_F_S(Snapshot) {
+  display_device::SchedulerMetrics metrics;
+  metrics.recordSchedule();
+  metrics.recordSchedule();
+  metrics.recordSchedule();
+  metrics.recordAttempt(10us);
+  metrics.recordAttempt(20us);
+  metrics.recordSuccess(2, 5ms);
+  metrics.recordException(1);
+  metrics.recordGiveUp(4);
+  metrics.recordMutexWait(3us);
+
+  const auto snapshot {metrics.snapshot()};
+  EXPECT_EQ(snapshot.m_schedules, 3);
+  EXPECT_EQ(snapshot.m_attempts, 2);
+  EXPECT_EQ(snapshot.m_successes, 1);
+  EXPECT_EQ(snapshot.m_exceptions, 1);
+  EXPECT_EQ(snapshot.m_give_ups, 1);
+  EXPECT_EQ(snapshot.m_attempts_per_schedule.m_count, 3);
+  EXPECT_EQ(snapshot.m_attempts_per_schedule.m_sum, 7);
+  EXPECT_EQ(snapshot.m_time_to_success_us.m_sum, 5000);
+  EXPECT_EQ(snapshot.m_callback_duration_us.m_sum, 30);
+  EXPECT_EQ(snapshot.m_mutex_wait_us.m_sum, 3);
+}
@@ -0,0 +1,166 @@
+// system includes
+#include <atomic>
+#include <future>
+#include <gmock/gmock.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// local includes
+#include "display_device/single_flight.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  using namespace std::chrono_literals;
+
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Test fixture(s) for this file
+  class SingleFlightTest: public BaseTest {
+  public:
+    // Computation that is slow enough for the concurrent callers to join it
+    int slowCompute() {
+      m_calls++;
+      std::this_thread::sleep_for(50ms);
+      return m_calls;
+    }
+
+    std::atomic_int m_calls {0};
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, SingleFlightTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(ConcurrentCallersShareComputation) {
+  display_device::SingleFlight<std::string, int> flight;
+
+  std::vector<std::future<int>> futures;
+  for (int i {0}; i < 8; ++i) {
+    futures.push_back(std::async(std::launch::async, [&]() {
+      return flight.get("devices", [&]() {
+        return slowCompute();
+      });
+    }));
+  }
+
+  for (auto &future : futures) {
+    EXPECT_EQ(future.get(), 1);
+  }
+  EXPECT_EQ(m_calls, 1);
+}
+
+TEST_F_S(DifferentKeysNotShared) {
+  display_device::SingleFlight<std::string, int> flight;
+
+  auto future_a {std::async(std::launch::async, [&]() {
+    return flight.get("a", [&]() {
+      return slowCompute();
+    });
+  })};
+  auto future_b {std::async(std::launch::async, [&]() {
+    return flight.get("b", [&]() {
+      return slowCompute();
+    });
+  })};
+
+  future_a.get();
+  future_b.get();
+  EXPECT_EQ(m_calls, 2);
+}
+
+TEST_F_S(NotCachedWithoutTtl) {
+  display_device::SingleFlight<std::string, int> flight;
+
+  EXPECT_EQ(flight.get("devices", [&]() {
+    return ++m_calls;
+  }),
+            1);
+  EXPECT_EQ(flight.get("devices", [&]() {
+    return ++m_calls;
+  }),
+            2);
+}
+
+TEST_F_S(Ttl, Cached) {
+  display_device::SingleFlight<std::string, int> flight {1000ms};
+
+  EXPECT_EQ(flight.get("devices", [&]() {
+    return ++m_calls;
+  }),
+            1);
+  EXPECT_EQ(flight.get("devices", [&]() {
+    return ++m_calls;
+  }),
+            1);
+}
+
+TEST_F_S(Ttl, Expired) {
+  display_device::SingleFlight<std::string, int> flight {10ms};
+
+  EXPECT_EQ(flight.get("devices", [&]() {
+    return ++m_calls;
+  }),
+            1);
+  std::this_thread::sleep_for(20ms);
+  EXPECT_EQ(flight.get("devices", [&]() {
+    return ++m_calls;
+  }),
+            2);
+}
+
+TEST_F_S(Invalidate) {
+  display_device::SingleFlight<std::string, int> flight {1000ms};
+
+  (void) flight.get("a", [&]() {
+    return ++m_calls;
+  });
+  (void) flight.get("b", [&]() {
+    return ++m_calls;
+  });
+
+  flight.invalidate("a");
+  EXPECT_EQ(flight.get("a", [&]() {
+    return ++m_calls;
+  }),
+            3);
+  EXPECT_EQ(flight.get("b", [&]() {
+    return ++m_calls;
+  }),
+            2);
+
+  flight.clear();
+  EXPECT_EQ(flight.get("b", [&]() {
+    return ++m_calls;
+  }),
+            4);
+}
+
+TEST_F_S(ExceptionThrown) {
+  display_device::SingleFlight<std::string, int> flight {1000ms};
+
+  std::vector<std::future<int>> futures;
+  for (int i {0}; i < 4; ++i) {
+    futures.push_back(std::async(std::launch::async, [&]() {
+      return flight.get("devices", [&]() -> int {
+        slowCompute();
+        throw std::runtime_error {"Get rekt!"};
+      });
+    }));
+  }
+
+  for (auto &future : futures) {
+    EXPECT_THAT([&]() {
+      (void) future.get();
+    },
+                ThrowsMessage<std::runtime_error>(HasSubstr("Get rekt!")));
+  }
+  EXPECT_EQ(m_calls, 1);
+
+  // Failures are not cached
+  EXPECT_EQ(flight.get("devices", [&]() {
+    return ++m_calls;
+  }),
+            2);
+}
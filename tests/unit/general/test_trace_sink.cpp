@@ -0,0 +1,225 @@
+// system includes
+#include <filesystem>
+#include <fstream>
+#include <gmock/gmock.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// local includes
+#include "display_device/trace_sink.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Test fixture(s) for this file
+  class TraceSinkTest: public BaseTest {
+  public:
+    ~TraceSinkTest() override {
+      std::error_code error_code;
+      std::filesystem::remove(m_filepath, error_code);
+    }
+
+    static std::vector<std::string> readLines(const std::filesystem::path &filepath) {
+      std::vector<std::string> lines;
+      const auto records {display_device::readTraceFile(filepath)};
+      if (records) {
+        for (const auto &record : *records) {
+          // Skip the timestamp
+          lines.push_back(display_device::formatTraceRecord(record).substr(std::string_view {"[2000-01-01T00:00:00.000000Z] "}.size()));
+        }
+      }
+      return lines;
+    }
+
+    std::filesystem::path m_filepath {"trace_sink_test.bin"};
+    display_device::TraceSink::Options m_options {.m_record_capacity = 4, .m_record_size = 64, .m_format_capacity = 2};
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, TraceSinkTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(InvalidOptions) {
+  EXPECT_THAT([&]() {
+    const display_device::TraceSink sink({}, m_options);
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Empty filename provided for TraceSink!")));
+  EXPECT_THAT([&]() {
+    m_options.m_record_capacity = 0;
+    const display_device::TraceSink sink(m_filepath, m_options);
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Record and format capacities specified in TraceSink must be larger than a 0!")));
+  EXPECT_THAT([&]() {
+    m_options.m_record_capacity = 1;
+    m_options.m_record_size = 100;
+    const display_device::TraceSink sink(m_filepath, m_options);
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Record size specified in TraceSink must be a multiple of 8 in the [64, 4096] range!")));
+}
+
+TEST_F_S(WriteAndDecode) {
+  enum class Color {
+    Red = 3
+  };
+
+  display_device::Logger::get().setTraceSink(std::make_shared<display_device::TraceSink>(m_filepath, display_device::TraceSink::Options {}));
+
+  DD_TRACE("No arguments {{escaped}}");
+  DD_TRACE("{} {} {} {} {} {}", true, -5, 7u, 1.5, "text", Color::Red);
+  DD_TRACE("Missing {} and {}", std::string {"one"});
+
+  EXPECT_EQ(readLines(m_filepath), (std::vector<std::string> {"No arguments {escaped}", "true -5 7 1.5 text 3", "Missing one and {}"}));
+}
+
+TEST_F_S(Disabled) {
+  int evaluated {0};
+  const auto evaluate {[&evaluated]() {
+    return ++evaluated;
+  }};
+
+  DD_TRACE("Value {}", evaluate());
+  EXPECT_EQ(evaluated, 0);
+
+  display_device::Logger::get().setTraceSink(std::make_shared<display_device::TraceSink>(m_filepath, m_options));
+  DD_TRACE("Value {}", evaluate());
+  EXPECT_EQ(evaluated, 1);
+
+  display_device::Logger::get().setTraceSink(nullptr);
+  DD_TRACE("Value {}", evaluate());
+  EXPECT_EQ(evaluated, 1);
+  EXPECT_EQ(readLines(m_filepath), (std::vector<std::string> {"Value 1"}));
+}
+
+TEST_F_S(OldestRecordsOverwritten) {
+  display_device::TraceSink sink {m_filepath, m_options};
+  for (int i {0}; i < 6; ++i) {
+    sink.write("Record {}", display_device::TraceArguments {i});
+  }
+
+  const auto records {display_device::readTraceFile(m_filepath)};
+  ASSERT_TRUE(records);
+  ASSERT_EQ(records->size(), 4);
+  EXPECT_EQ(records->front().m_sequence, 3);
+  EXPECT_EQ(readLines(m_filepath), (std::vector<std::string> {"Record 2", "Record 3", "Record 4", "Record 5"}));
+}
+
+TEST_F_S(ExistingFileContinued) {
+  {
+    display_device::TraceSink sink {m_filepath, m_options};
+    sink.write("Record {}", display_device::TraceArguments {1});
+  }
+  {
+    display_device::TraceSink sink {m_filepath, m_options};
+    sink.write("Record {}", display_device::TraceArguments {2});
+    sink.flush();
+  }
+  EXPECT_EQ(readLines(m_filepath), (std::vector<std::string> {"Record 1", "Record 2"}));
+
+  // Different layout starts over
+  {
+    display_device::TraceSink sink {m_filepath, {.m_record_capacity = 8, .m_record_size = 64, .m_format_capacity = 2}};
+    sink.write("Record {}", display_device::TraceArguments {3});
+  }
+  EXPECT_EQ(readLines(m_filepath), (std::vector<std::string> {"Record 3"}));
+}
+
+TEST_F_S(HalfWrittenRecordSkipped) {
+  {
+    display_device::TraceSink sink {m_filepath, m_options};
+    sink.write("Record {}", display_device::TraceArguments {1});
+  }
+
+  // Simulate a crash in the middle of writing by setting the highest bit of the first record's sequence
+  {
+    constexpr std::size_t sequence_offset {64 + 2 * 256 + 7};  // File header + format entries + the last byte of the little-endian sequence
+    std::fstream stream {m_filepath, std::ios::binary | std::ios::in | std::ios::out};
+    stream.seekp(sequence_offset);
+    stream.put(static_cast<char>(0x80));
+  }
+  EXPECT_EQ(readLines(m_filepath), std::vector<std::string> {});
+
+  // The slot can be used again once the file is continued
+  {
+    display_device::TraceSink sink {m_filepath, m_options};
+    for (int i {2}; i < 6; ++i) {
+      sink.write("Record {}", display_device::TraceArguments {i});
+    }
+    EXPECT_EQ(sink.getDroppedCount(), 0);
+  }
+  EXPECT_EQ(readLines(m_filepath), (std::vector<std::string> {"Record 2", "Record 3", "Record 4", "Record 5"}));
+}
+
+TEST_F_S(ConcurrentWritersNoMixedRecords) {
+  display_device::TraceSink sink {m_filepath, m_options};
+
+  std::vector<std::thread> writers;
+  for (char letter {'a'}; letter < 'e'; ++letter) {
+    writers.emplace_back([&sink, text = std::string(24, letter)]() {
+      for (int i {0}; i < 10000; ++i) {
+        sink.write("{}", display_device::TraceArguments {text});
+      }
+    });
+  }
+  for (auto &writer : writers) {
+    writer.join();
+  }
+
+  const auto lines {readLines(m_filepath)};
+  EXPECT_EQ(lines.size(), 4);
+  for (const auto &line : lines) {
+    ASSERT_EQ(line.size(), 24);
+    EXPECT_EQ(line, std::string(24, line.front()));
+  }
+  EXPECT_LE(sink.getDroppedCount(), 4 * 10000);
+}
+
+TEST_F_S(ArgumentsTruncated) {
+  display_device::TraceSink sink {m_filepath, m_options};
+  const std::string long_text(40, 'a');
+  sink.write("{} {}", display_device::TraceArguments {long_text, 1});
+
+  const display_device::TraceArguments arguments {std::string(300, 'b')};
+  EXPECT_TRUE(arguments.isTruncated());
+  EXPECT_EQ(arguments.getBytes().size(), display_device::TraceArguments::m_capacity);
+
+  // Record slot of 64 bytes leaves 32 bytes for the arguments
+  EXPECT_EQ(readLines(m_filepath), (std::vector<std::string> {std::string(29, 'a') + " {} [truncated]"}));
+}
+
+TEST_F_S(DictionaryFull) {
+  display_device::TraceSink sink {m_filepath, m_options};
+  sink.write("First {}", display_device::TraceArguments {1});
+  sink.write("Second {}", display_device::TraceArguments {2});
+  sink.write("Third {}", display_device::TraceArguments {3, "x"});
+
+  EXPECT_EQ(readLines(m_filepath), (std::vector<std::string> {"First 1", "Second 2", "<unknown format> 3 x"}));
+}
+
+TEST_F_S(InvalidFile) {
+  EXPECT_EQ(display_device::readTraceFile(m_filepath), std::nullopt);
+
+  {
+    std::ofstream stream {m_filepath, std::ios::binary};
+    stream << "definitely not a trace file, but long enough to contain the whole header of it";
+  }
+  EXPECT_EQ(display_device::readTraceFile(m_filepath), std::nullopt);
+
+  {
+    display_device::TraceSink sink {m_filepath, m_options};
+  }
+  std::filesystem::resize_file(m_filepath, std::filesystem::file_size(m_filepath) - 1);
+  EXPECT_EQ(display_device::readTraceFile(m_filepath), std::nullopt);
+}
+
+TEST_F_S(FormatTimestamp) {
+  const display_device::TraceRecord record {
+    .m_timestamp = std::chrono::sys_days {std::chrono::year {2024} / 2 / 29} + std::chrono::hours {13} + std::chrono::minutes {5} + std::chrono::seconds {9} + std::chrono::microseconds {42},
+    .m_format = "Hello {}!",
+    .m_arguments = {std::string {"World"}}
+  };
+  EXPECT_EQ(display_device::formatTraceRecord(record), "[2024-02-29T13:05:09.000042Z] Hello World!");
+}
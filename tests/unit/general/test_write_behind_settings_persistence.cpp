@@ -0,0 +1,262 @@
+// system includes
+#include <future>
+#include <gmock/gmock.h>
+#include <stdexcept>
+#include <thread>
+
+// local includes
+#include "display_device/write_behind_settings_persistence.h"
+#include "fixtures/fixtures.h"
+#include "fixtures/mock_settings_persistence.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+  using ::testing::InSequence;
+  using ::testing::Return;
+  using ::testing::StrictMock;
+
+  // Test fixture(s) for this file
+  class WriteBehindSettingsPersistenceTest: public BaseTest {
+  public:
+    display_device::WriteBehindSettingsPersistence &getImpl(display_device::WriteBehindSettingsPersistence::Policy policy = display_device::WriteBehindSettingsPersistence::Policy::Latency) {
+      if (!m_impl) {
+        m_impl = std::make_unique<display_device::WriteBehindSettingsPersistence>(m_settings_persistence_api, policy);
+      }
+
+      return *m_impl;
+    }
+
+    // Action that keeps the write in progress until the gate is opened
+    auto blockUntilOpened(const bool result) {
+      return [this, result]() {
+        m_write_started.set_value();
+        m_gate_future.wait();
+        return result;
+      };
+    }
+
+    void waitForWriteStart() {
+      m_write_started.get_future().wait();
+    }
+
+    void openGate() {
+      m_gate.set_value();
+    }
+
+    std::shared_ptr<StrictMock<display_device::MockSettingsPersistence>> m_settings_persistence_api {std::make_shared<StrictMock<display_device::MockSettingsPersistence>>()};
+    std::unique_ptr<display_device::WriteBehindSettingsPersistence> m_impl;
+    std::promise<void> m_write_started;
+    std::promise<void> m_gate;
+    std::shared_future<void> m_gate_future {m_gate.get_future().share()};
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, WriteBehindSettingsPersistenceTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(NullptrInterface) {
+  EXPECT_THAT([]() {
+    const display_device::WriteBehindSettingsPersistence persistence {nullptr};
+  },
+              ThrowsMessage<std::invalid_argument>(HasSubstr("Nullptr interface provided in WriteBehindSettingsPersistence!")));
+}
+
+TEST_F_S(GetPersistenceApi) {
+  EXPECT_EQ(getImpl().getPersistenceApi(), m_settings_persistence_api);
+}
+
+TEST_F_S(Store, AcknowledgedBeforeWrite) {
+  const std::vector<std::uint8_t> data {0x01, 0x02, 0x03};
+  EXPECT_CALL(*m_settings_persistence_api, store(data))
+    .Times(1)
+    .WillOnce([this](auto &) {
+      return blockUntilOpened(true)();
+    });
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(data));
+
+  EXPECT_TRUE(getImpl().store(data));
+  waitForWriteStart();
+  EXPECT_EQ(getImpl().load(), data);
+
+  openGate();
+  EXPECT_TRUE(getImpl().flush());
+  EXPECT_EQ(getImpl().load(), data);
+}
+
+TEST_F_S(Clear, AcknowledgedBeforeWrite) {
+  EXPECT_CALL(*m_settings_persistence_api, clear())
+    .Times(1)
+    .WillOnce(blockUntilOpened(true));
+
+  EXPECT_TRUE(getImpl().clear());
+  waitForWriteStart();
+  EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {});
+
+  const auto view {getImpl().loadView()};
+  ASSERT_TRUE(view);
+  EXPECT_TRUE(view->empty());
+
+  openGate();
+  EXPECT_TRUE(getImpl().flush());
+}
+
+TEST_F_S(LoadView, PendingData) {
+  const std::vector<std::uint8_t> data {0x01, 0x02, 0x03};
+  EXPECT_CALL(*m_settings_persistence_api, store(data))
+    .Times(1)
+    .WillOnce([this](auto &) {
+      return blockUntilOpened(true)();
+    });
+
+  EXPECT_TRUE(getImpl().store(data));
+  waitForWriteStart();
+
+  const auto view {getImpl().loadView()};
+  ASSERT_TRUE(view);
+  EXPECT_EQ(std::vector<std::uint8_t>(std::begin(view->getData()), std::end(view->getData())), data);
+
+  openGate();
+  EXPECT_TRUE(getImpl().flush());
+}
+
+TEST_F_S(Load, NothingPending) {
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(2)
+    .WillRepeatedly(Return(std::vector<std::uint8_t> {0x01}));
+
+  EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {0x01});
+
+  const auto view {getImpl().loadView()};
+  ASSERT_TRUE(view);
+  EXPECT_EQ(view->getString(), "\x01");
+}
+
+TEST_F_S(WritesAreOrderedAndSuperseded) {
+  {
+    InSequence sequence;
+    EXPECT_CALL(*m_settings_persistence_api, store(std::vector<std::uint8_t> {0x01}))
+      .Times(1)
+      .WillOnce([this](auto &) {
+        return blockUntilOpened(true)();
+      });
+    EXPECT_CALL(*m_settings_persistence_api, store(std::vector<std::uint8_t> {0x03}))
+      .Times(1)
+      .WillOnce(Return(true));
+  }
+
+  EXPECT_TRUE(getImpl().store({0x01}));
+  waitForWriteStart();
+  EXPECT_TRUE(getImpl().clear());
+  EXPECT_TRUE(getImpl().store({0x03}));
+  EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {0x03});
+
+  openGate();
+  EXPECT_TRUE(getImpl().flush());
+}
+
+TEST_F_S(Flush, NothingPending) {
+  EXPECT_TRUE(getImpl().flush());
+}
+
+TEST_F_S(Flush, ReportsFailedWrite) {
+  EXPECT_CALL(*m_settings_persistence_api, store(std::vector<std::uint8_t> {0x01}))
+    .Times(1)
+    .WillOnce(Return(false));
+
+  EXPECT_TRUE(getImpl().store({0x01}));
+  EXPECT_FALSE(getImpl().flush());
+  EXPECT_TRUE(getImpl().flush());
+
+  // The acknowledged data is still returned even though it failed to be written
+  EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {0x01});
+}
+
+TEST_F_S(Flush, ReportsException) {
+  EXPECT_CALL(*m_settings_persistence_api, clear())
+    .Times(1)
+    .WillOnce([]() -> bool {
+      throw std::runtime_error {"Disk is gone!"};
+    });
+
+  EXPECT_TRUE(getImpl().clear());
+  EXPECT_FALSE(getImpl().flush());
+}
+
+TEST_F_S(Durability, ReturnsWriteResult) {
+  {
+    InSequence sequence;
+    EXPECT_CALL(*m_settings_persistence_api, store(std::vector<std::uint8_t> {0x01}))
+      .Times(1)
+      .WillOnce(Return(true));
+    EXPECT_CALL(*m_settings_persistence_api, clear())
+      .Times(1)
+      .WillOnce(Return(false));
+  }
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(2)
+    .WillRepeatedly(Return(std::vector<std::uint8_t> {0x01}));
+
+  auto &impl {getImpl(display_device::WriteBehindSettingsPersistence::Policy::Durability)};
+  EXPECT_TRUE(impl.store({0x01}));
+  EXPECT_EQ(impl.load(), std::vector<std::uint8_t> {0x01});
+  EXPECT_FALSE(impl.clear());
+
+  // The failed clear was not acknowledged, so the written data is still returned
+  EXPECT_EQ(impl.load(), std::vector<std::uint8_t> {0x01});
+}
+
+TEST_F_S(Durability, ResultIsNotOverwrittenByNewerWrite) {
+  {
+    InSequence sequence;
+    EXPECT_CALL(*m_settings_persistence_api, store(std::vector<std::uint8_t> {0x01}))
+      .Times(1)
+      .WillOnce([this](auto &) {
+        return blockUntilOpened(true)();
+      });
+    EXPECT_CALL(*m_settings_persistence_api, store(std::vector<std::uint8_t> {0x02}))
+      .Times(1)
+      .WillOnce(Return(false));
+  }
+
+  auto &impl {getImpl(display_device::WriteBehindSettingsPersistence::Policy::Durability)};
+  auto first_result {std::async(std::launch::async, [&impl]() {
+    return impl.store({0x01});
+  })};
+  waitForWriteStart();
+
+  auto second_result {std::async(std::launch::async, [&impl]() {
+    return impl.store({0x02});
+  })};
+  while (impl.load() != std::vector<std::uint8_t> {0x02}) {
+    std::this_thread::yield();
+  }
+
+  // The failed write, finishing right after the first one, must not change the first result
+  openGate();
+  EXPECT_TRUE(first_result.get());
+  EXPECT_FALSE(second_result.get());
+}
+
+TEST_F_S(Destructor, WritesQueuedOperation) {
+  {
+    InSequence sequence;
+    EXPECT_CALL(*m_settings_persistence_api, store(std::vector<std::uint8_t> {0x01}))
+      .Times(1)
+      .WillOnce([this](auto &) {
+        return blockUntilOpened(true)();
+      });
+    EXPECT_CALL(*m_settings_persistence_api, store(std::vector<std::uint8_t> {0x02}))
+      .Times(1)
+      .WillOnce(Return(true));
+  }
+
+  EXPECT_TRUE(getImpl().store({0x01}));
+  waitForWriteStart();
+  EXPECT_TRUE(getImpl().store({0x02}));
+
+  openGate();
+  m_impl.reset();
+}
@@ -1,4 +1,5 @@
 // local includes
+#include "display_device/detail/persistent_state_utils.h"
 #include "display_device/macos/json.h"
 #include "display_device/macos/persistent_state.h"
 #include "display_device/noop_settings_persistence.h"
@@ -8,6 +9,7 @@
 namespace {
   // Convenience keywords for GMock
   using ::testing::_;
+  using ::testing::HasSubstr;
   using ::testing::Return;
   using ::testing::StrictMock;
 
@@ -105,3 +107,94 @@ TEST_F_S(ClearState) {
   EXPECT_TRUE(persistent_state.persistState(std::nullopt));
   EXPECT_FALSE(persistent_state.getState());
 }
+
+TEST_F_S(StoreState, BinaryEncoding) {
+  const auto state {makeState()};
+  std::string error_message;
+  const auto binary_state {display_device::detail::encodeState(state, display_device::PersistenceEncoding::Binary, error_message)};
+  ASSERT_TRUE(binary_state);
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(std::optional<std::vector<std::uint8_t>> {std::vector<std::uint8_t> {}}));
+
+  display_device::MacPersistentState persistent_state {m_settings_persistence_api, false, display_device::PersistenceEncoding::Binary};
+
+  EXPECT_CALL(*m_settings_persistence_api, store(*binary_state))
+    .Times(1)
+    .WillOnce(Return(true));
+
+  EXPECT_TRUE(persistent_state.persistState(state));
+  EXPECT_EQ(persistent_state.getState(), state);
+}
+
+TEST_F_S(LoadState, BinaryEncoding) {
+  const auto state {makeState()};
+  std::string error_message;
+  const auto binary_state {display_device::detail::encodeState(state, display_device::PersistenceEncoding::Binary, error_message)};
+  ASSERT_TRUE(binary_state);
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(*binary_state));
+
+  const display_device::MacPersistentState persistent_state {m_settings_persistence_api, true};
+  EXPECT_EQ(persistent_state.getState(), state);
+}
+
+TEST_F_S(LazyLoad, LoadedOnFirstAccess) {
+  const auto state {makeState()};
+
+  const display_device::MacPersistentState persistent_state {m_settings_persistence_api, false, display_device::PersistenceEncoding::Json, display_device::PersistenceLoadMode::Lazy};
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(serializeState(state)));
+
+  EXPECT_EQ(persistent_state.getState(), state);
+  EXPECT_EQ(persistent_state.getState(), state);
+}
+
+TEST_F_S(LazyLoad, LoadedBeforePersist) {
+  const auto state {makeState()};
+
+  display_device::MacPersistentState persistent_state {m_settings_persistence_api, false, display_device::PersistenceEncoding::Json, display_device::PersistenceLoadMode::Lazy};
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(serializeState(state)));
+
+  // Same as the stored state, so nothing is written
+  EXPECT_TRUE(persistent_state.persistState(state));
+}
+
+TEST_F_S(LazyLoad, ErrorThrownOnFirstAccess) {
+  const display_device::MacPersistentState persistent_state {m_settings_persistence_api, true, display_device::PersistenceEncoding::Json, display_device::PersistenceLoadMode::Lazy};
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(std::nullopt));
+
+  EXPECT_THAT([&persistent_state]() {
+    (void) persistent_state.getState();
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Failed to load macOS persistent settings!")));
+}
+
+TEST_F_S(LazyLoad, RetryAfterParseError) {
+  const std::string data_string {"SOMETHING"};
+  const display_device::MacPersistentState persistent_state {m_settings_persistence_api, true, display_device::PersistenceEncoding::Json, display_device::PersistenceLoadMode::Lazy};
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(2)
+    .WillOnce(Return(std::vector<std::uint8_t> {std::begin(data_string), std::end(data_string)}))
+    .WillOnce(Return(std::vector<std::uint8_t> {}));
+
+  EXPECT_THAT([&persistent_state]() {
+    (void) persistent_state.getState();
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Failed to parse macOS persistent settings!")));
+
+  // Nothing from the failed parse is left behind
+  EXPECT_EQ(persistent_state.getState(), std::nullopt);
+}
@@ -427,6 +427,44 @@ TEST_F_S(RevertSettings, PersistenceFailureRollsBackModes) {
   EXPECT_EQ(getImpl().revertSettings(), display_device::MacSettingsManager::RevertResult::PersistenceSaveFailed);
 }
 
+TEST_F_S(RevertSettings, RepeatedErrorIsSuppressed) {
+  auto state {makeModeState()};
+  state.m_modified.m_topology = {{"DeviceId2"}};
+
+  expectStoredStateLoad(state);
+  EXPECT_CALL(*m_dd_api, isApiAccessAvailable())
+    .Times(3)
+    .WillRepeatedly(Return(true));
+  EXPECT_CALL(*m_dd_api, getCurrentTopology())
+    .Times(3)
+    .WillRepeatedly(Return(DEFAULT_TOPOLOGY));
+  EXPECT_CALL(*m_dd_api, isTopologyValid(DEFAULT_TOPOLOGY))
+    .Times(3)
+    .WillRepeatedly(Return(true));
+  EXPECT_CALL(*m_dd_api, isTopologyValid(state.m_modified.m_topology))
+    .Times(3)
+    .WillRepeatedly(Return(true));
+  EXPECT_CALL(*m_dd_api, isTopologyTheSame(DEFAULT_TOPOLOGY, state.m_modified.m_topology))
+    .Times(3)
+    .WillRepeatedly(Return(false));
+
+  std::vector<std::string> output;
+  auto &logger {display_device::Logger::get()};
+  logger.setLogLevel(display_device::Logger::LogLevel::info);
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output.emplace_back(value);
+  });
+
+  for (int i {0}; i < 3; ++i) {
+    EXPECT_EQ(getImpl().revertSettings(), display_device::MacSettingsManager::RevertResult::SwitchingTopologyFailed);
+  }
+  EXPECT_EQ(output, (std::vector<std::string> {"Cannot revert macOS display modes because topology changes are not supported in phase 2."}));
+
+  // The suppressed repeats are reported when the manager is destroyed
+  m_impl.reset();
+  EXPECT_EQ(output, (std::vector<std::string> {"Cannot revert macOS display modes because topology changes are not supported in phase 2.", "Suppressed 2 repeat(s) of the message: Cannot revert macOS display modes because topology changes are not supported in phase 2."}));
+}
+
 TEST_F_S(RevertSettings, TopologyUnsupported) {
   auto state {makeModeState()};
   state.m_modified.m_topology = {{"DeviceId2"}};
@@ -1,5 +1,7 @@
 // local includes
+#include "display_device/detail/persistent_state_utils.h"
 #include "display_device/noop_settings_persistence.h"
+#include "display_device/windows/json.h"
 #include "display_device/windows/settings_manager.h"
 #include "fixtures/fixtures.h"
 #include "fixtures/mock_settings_persistence.h"
@@ -16,9 +18,9 @@ namespace {
   // Test fixture(s) for this file
   class PersistentStateMocked: public BaseTest {
   public:
-    display_device::PersistentState &getImpl(bool throw_on_load_error = false) {
+    display_device::PersistentState &getImpl(bool throw_on_load_error = false, display_device::PersistenceEncoding encoding = display_device::PersistenceEncoding::Json) {
       if (!m_impl) {
-        m_impl = std::make_unique<display_device::PersistentState>(m_settings_persistence_api, throw_on_load_error);
+        m_impl = std::make_unique<display_device::PersistentState>(m_settings_persistence_api, throw_on_load_error, encoding);
       }
 
       return *m_impl;
@@ -164,3 +166,99 @@ TEST_F_S_MOCKED(PersistStateSkippedDueToEqValues) {
   EXPECT_TRUE(getImpl().persistState(ut_consts::SDCS_FULL));
   EXPECT_EQ(getImpl().getState(), ut_consts::SDCS_FULL);
 }
+
+TEST_F_S_MOCKED(StoreState, BinaryEncoding) {
+  std::string error_message;
+  const auto binary_state {display_device::detail::encodeState(*ut_consts::SDCS_FULL, display_device::PersistenceEncoding::Binary, error_message)};
+  ASSERT_TRUE(binary_state);
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(serializeState(ut_consts::SDCS_NO_MODIFICATIONS)));
+  EXPECT_CALL(*m_settings_persistence_api, store(*binary_state))
+    .Times(1)
+    .WillOnce(Return(true));
+
+  EXPECT_EQ(getImpl(false, display_device::PersistenceEncoding::Binary).getState(), ut_consts::SDCS_NO_MODIFICATIONS);
+  EXPECT_TRUE(getImpl().persistState(ut_consts::SDCS_FULL));
+  EXPECT_EQ(getImpl().getState(), ut_consts::SDCS_FULL);
+}
+
+TEST_F_S_MOCKED(LoadState, BinaryEncoding) {
+  std::string error_message;
+  const auto binary_state {display_device::detail::encodeState(*ut_consts::SDCS_FULL, display_device::PersistenceEncoding::Binary, error_message)};
+  ASSERT_TRUE(binary_state);
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(*binary_state));
+
+  EXPECT_EQ(getImpl(true).getState(), ut_consts::SDCS_FULL);
+}
+
+TEST_F_S_MOCKED(LazyLoad, LoadedOnFirstAccess) {
+  const display_device::PersistentState persistent_state {m_settings_persistence_api, false, display_device::PersistenceEncoding::Json, display_device::PersistenceLoadMode::Lazy};
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(serializeState(ut_consts::SDCS_FULL)));
+
+  EXPECT_EQ(persistent_state.getState(), ut_consts::SDCS_FULL);
+  EXPECT_EQ(persistent_state.getState(), ut_consts::SDCS_FULL);
+}
+
+TEST_F_S_MOCKED(LazyLoad, LoadedBeforePersist) {
+  display_device::PersistentState persistent_state {m_settings_persistence_api, false, display_device::PersistenceEncoding::Json, display_device::PersistenceLoadMode::Lazy};
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(serializeState(ut_consts::SDCS_FULL)));
+
+  EXPECT_TRUE(persistent_state.persistState(ut_consts::SDCS_FULL));
+  EXPECT_EQ(persistent_state.getState(), ut_consts::SDCS_FULL);
+}
+
+TEST_F_S_MOCKED(LazyLoad, ErrorThrownOnFirstAccess) {
+  const display_device::PersistentState persistent_state {m_settings_persistence_api, true, display_device::PersistenceEncoding::Json, display_device::PersistenceLoadMode::Lazy};
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(2)
+    .WillRepeatedly(Return(serializeState(ut_consts::SDCS_NULL)));
+
+  // The failed load is retried on every access
+  for (int i {0}; i < 2; ++i) {
+    EXPECT_THAT([&persistent_state]() {
+      (void) persistent_state.getState();
+    },
+                ThrowsMessage<std::runtime_error>(HasSubstr("Failed to load persistent settings!")));
+  }
+}
+
+TEST_F_S_MOCKED(LazyLoad, ErrorSuppressed) {
+  const display_device::PersistentState persistent_state {m_settings_persistence_api, false, display_device::PersistenceEncoding::Json, display_device::PersistenceLoadMode::Lazy};
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(serializeState(ut_consts::SDCS_NULL)));
+
+  EXPECT_EQ(persistent_state.getState(), std::nullopt);
+  EXPECT_EQ(persistent_state.getState(), std::nullopt);
+}
+
+TEST_F_S_MOCKED(LazyLoad, RetryAfterParseError) {
+  const std::string data_string {"SOMETHING"};
+  const display_device::PersistentState persistent_state {m_settings_persistence_api, true, display_device::PersistenceEncoding::Json, display_device::PersistenceLoadMode::Lazy};
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(2)
+    .WillOnce(Return(std::vector<std::uint8_t> {std::begin(data_string), std::end(data_string)}))
+    .WillOnce(Return(std::vector<std::uint8_t> {}));
+
+  EXPECT_THAT([&persistent_state]() {
+    (void) persistent_state.getState();
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Failed to parse persistent settings!")));
+
+  // Nothing from the failed parse is left behind
+  EXPECT_EQ(persistent_state.getState(), std::nullopt);
+}
@@ -314,6 +314,41 @@ TEST_F_S_MOCKED(InvalidCurrentTopology) {
   EXPECT_EQ(getImpl().revertSettings(), display_device::SettingsManager::RevertResult::TopologyIsInvalid);
 }
 
+TEST_F_S_MOCKED(InvalidCurrentTopology, RepeatedRecordsAreSuppressed) {
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(serializeState(ut_consts::SDCS_FULL)));
+  EXPECT_CALL(*m_dd_api, isApiAccessAvailable())
+    .Times(3)
+    .WillRepeatedly(Return(true));
+  EXPECT_CALL(*m_dd_api, getCurrentTopology())
+    .Times(3)
+    .WillRepeatedly(Return(CURRENT_TOPOLOGY));
+  EXPECT_CALL(*m_dd_api, isTopologyValid(CURRENT_TOPOLOGY))
+    .Times(3)
+    .WillRepeatedly(Return(false));
+
+  std::vector<std::string> output;
+  auto &logger {display_device::Logger::get()};
+  logger.setLogLevel(display_device::Logger::LogLevel::info);
+  logger.setCustomCallback([&output](auto, const std::string_view value) {
+    output.emplace_back(value);
+  });
+
+  for (int i {0}; i < 3; ++i) {
+    EXPECT_EQ(getImpl().revertSettings(), display_device::SettingsManager::RevertResult::TopologyIsInvalid);
+  }
+  ASSERT_EQ(output.size(), 2);
+  EXPECT_THAT(output[0], HasSubstr("Trying to revert applied display device settings."));
+  EXPECT_THAT(output[1], HasSubstr("Retrieved current topology is invalid:"));
+
+  // The suppressed repeats are reported when the manager is destroyed
+  m_impl.reset();
+  ASSERT_EQ(output.size(), 4);
+  EXPECT_EQ(output[2], "Suppressed 2 repeat(s) of the message: Retrieved current topology is invalid:");
+  EXPECT_THAT(output[3], HasSubstr("Suppressed 2 repeat(s) of the message: Trying to revert applied display device settings."));
+}
+
 TEST_F_S_MOCKED(RevertModifiedSettings, InvalidModifiedTopology) {
   InSequence sequence;
   expectedDefaultCallsUntilModifiedSettings(sequence);
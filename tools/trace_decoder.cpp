@@ -0,0 +1,30 @@
+/**
+ * @file tools/trace_decoder.cpp
+ * @brief Renders the trace file written by the TraceSink as text.
+ */
+// system includes
+#include <iostream>
+
+// local includes
+#include "display_device/trace_sink.h"
+
+int main(int argc, char *argv[]) {
+  if (argc != 2) {
+    std::cerr << "Usage: " << argv[0] << " <trace file>" << std::endl;
+    return 1;
+  }
+
+  const auto records {display_device::readTraceFile(argv[1])};
+  if (!records) {
+    // Error already logged
+    return 1;
+  }
+
+  if (!records->empty() && records->front().m_sequence > 1) {
+    std::cout << "(" << records->front().m_sequence - 1 << " older record(s) were overwritten)\n";
+  }
+  for (const auto &record : *records) {
+    std::cout << display_device::formatTraceRecord(record) << '\n';
+  }
+  return 0;
+}